@@ -0,0 +1,117 @@
+/*
+ *  Contention benchmark : N threads claim every bit of a shared bitset then release them,
+ *  with h_atomic_bitset_t versus a mutex protected h_bitset_t.
+ *
+ *  usage : bench_atomic_bitset [nbits] [nthreads] [rounds]
+ */
+
+#include "bench_common.h"
+#include <pthread.h>
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+static size_t nbits, nthreads, rounds;
+static h_atomic_bitset_t abitset;
+static h_bitset_t mbitset;
+static pthread_mutex_t mbitset_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_barrier_t barrier;
+static double *t_begin, *t_end;
+
+static void *atomic_worker(void *arg) {
+    size_t tid = (size_t)arg;
+    size_t per_thread = nbits / nthreads;
+    size_t *claimed = malloc(per_thread * sizeof(size_t));
+
+    pthread_barrier_wait(&barrier);
+    t_begin[tid] = bench_now();
+    for (size_t r=0;r<rounds;++r) {
+        size_t hint = h_atomic_bitset_thread_hint(&abitset, tid, nthreads);
+        size_t n = 0;
+        while (n < per_thread && h_atomic_bitset_claim(&abitset, &hint, &claimed[n])) n++;
+        for (size_t i=0;i<n;++i) h_atomic_bitset_clear(&abitset, claimed[i]);
+    }
+    t_end[tid] = bench_now();
+    free(claimed);
+    return NULL;
+}
+
+static bool mutex_claim(size_t *hint, size_t *out_idx) {
+    pthread_mutex_lock(&mbitset_lock);
+    for (size_t i=0;i<nbits;++i) {
+        size_t idx = (*hint + i) % nbits;
+        if (!h_bitset_get(&mbitset, idx)) {
+            h_bitset_set(&mbitset, idx);
+            pthread_mutex_unlock(&mbitset_lock);
+            *hint = idx + 1;
+            *out_idx = idx;
+            return true;
+        }
+    }
+    pthread_mutex_unlock(&mbitset_lock);
+    return false;
+}
+
+static void *mutex_worker(void *arg) {
+    size_t tid = (size_t)arg;
+    size_t per_thread = nbits / nthreads;
+    size_t *claimed = malloc(per_thread * sizeof(size_t));
+
+    pthread_barrier_wait(&barrier);
+    t_begin[tid] = bench_now();
+    for (size_t r=0;r<rounds;++r) {
+        size_t hint = per_thread * tid;
+        size_t n = 0;
+        while (n < per_thread && mutex_claim(&hint, &claimed[n])) n++;
+        for (size_t i=0;i<n;++i) {
+            pthread_mutex_lock(&mbitset_lock);
+            h_bitset_clear(&mbitset, claimed[i]);
+            pthread_mutex_unlock(&mbitset_lock);
+        }
+    }
+    t_end[tid] = bench_now();
+    free(claimed);
+    return NULL;
+}
+
+static double run(void *(*worker)(void*)) {
+    pthread_t *threads = malloc(nthreads * sizeof(pthread_t));
+    t_begin = malloc(nthreads * sizeof(double));
+    t_end = malloc(nthreads * sizeof(double));
+    pthread_barrier_init(&barrier, NULL, (unsigned)nthreads);
+    for (size_t t=0;t<nthreads;++t) pthread_create(&threads[t], NULL, worker, (void*)t);
+    for (size_t t=0;t<nthreads;++t) pthread_join(threads[t], NULL);
+
+    // wall time from the first thread starting to the last one finishing
+    double begin = t_begin[0], end = t_end[0];
+    for (size_t t=1;t<nthreads;++t) {
+        if (t_begin[t] < begin) begin = t_begin[t];
+        if (t_end[t] > end) end = t_end[t];
+    }
+    pthread_barrier_destroy(&barrier);
+    free(threads);
+    free(t_begin);
+    free(t_end);
+    return end - begin;
+}
+
+int main(int argc, char **argv) {
+    nbits = bench_arg(argc, argv, 1, 1 << 16);
+    nthreads = bench_arg(argc, argv, 2, 4);
+    rounds = bench_arg(argc, argv, 3, 16);
+    size_t ops = (nbits / nthreads) * nthreads * rounds * 2;
+
+    abitset = h_create_atomic_bitset(nbits);
+    bench_report("atomic bitset claim/clear", ops, run(atomic_worker));
+    h_atomic_bitset_free(&abitset);
+
+    // pre-grow so the locked version never reallocs during the run
+    mbitset = h_create_bitset();
+    while (mbitset.size * 64 < nbits) h_bitset_set(&mbitset, mbitset.size * 64);
+    h_bitset_clear_all(&mbitset);
+    bench_report("mutex + h_bitset claim/clear", ops, run(mutex_worker));
+    h_bitset_free(&mbitset);
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ *  Ordered lookups : h_btree_t (integer keys with SIMD node search, and the same keys through a
+ *  comparator) against binary search over a sorted array, for point lookups, lower_bound and
+ *  short range scans. Also bulk loading versus one-by-one inserts.
+ *
+ *  usage : bench_btree [pairs] [queries] [scan_length]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+typedef struct pair_t {
+    u64 key;
+    u64 value;
+} pair_t;
+
+static int pair_order(void const *key, void const *pair) {
+    u64 a = *(u64 const*)key, b = ((pair_t const*)pair)->key;
+    return (a > b) - (a < b);
+}
+
+static pair_t const *array_lower_bound(pair_t const *pairs, size_t n, u64 key) {
+    size_t lo = 0;
+    while (n > 1) {
+        size_t half = n / 2;
+        lo = pairs[lo + half - 1].key < key ? lo + half : lo;
+        n -= half;
+    }
+    return n && pairs[lo].key < key ? pairs + lo + 1 : pairs + lo;
+}
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 1 << 22);
+    size_t queries = bench_arg(argc, argv, 2, 1 << 21);
+    size_t scan = bench_arg(argc, argv, 3, 100);
+    h_rng_t rng = h_create_rng(17);
+
+    // even keys, odd queries miss
+    h_array_t sorted = H_CREATE_ARRAY(pair_t, n);
+    for (size_t i=0;i<n;++i) H_ARRAY_PUSH(pair_t, sorted, ((pair_t){2 * i, i}));
+    pair_t const *pairs = sorted.data;
+    u64 *keys = malloc(queries * sizeof(u64));
+    for (size_t i=0;i<queries;++i) keys[i] = h_rng_bounded_u64(&rng, 2 * n);
+
+    double t0 = bench_now();
+    h_btree_t tree = H_CREATE_BTREE_INT(pair_t, H_BTREE_KEY_U64);
+    h_btree_bulk_load(&tree, &sorted);
+    bench_report("btree bulk load", n, bench_now() - t0);
+    h_btree_t custom = H_CREATE_BTREE(pair_t, pair_order);
+    h_btree_bulk_load(&custom, &sorted);
+
+    u64 *shuffled = malloc(n * sizeof(u64));
+    for (size_t i=0;i<n;++i) shuffled[i] = 2 * i;
+    for (size_t i=n;i>1;--i) {
+        size_t j = h_rng_bounded_u64(&rng, i);
+        u64 tmp = shuffled[i - 1];
+        shuffled[i - 1] = shuffled[j];
+        shuffled[j] = tmp;
+    }
+    t0 = bench_now();
+    h_btree_t inserted = H_CREATE_BTREE_INT(pair_t, H_BTREE_KEY_U64);
+    for (size_t i=0;i<n;++i) h_btree_put(&inserted, &(pair_t){shuffled[i], i});
+    bench_report("btree put, random order", n, bench_now() - t0);
+    h_btree_free(&inserted);
+    free(shuffled);
+
+    u64 acc = 0;
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        pair_t const *pair = array_lower_bound(pairs, n, keys[i]);
+        acc += pair < pairs + n && pair->key == keys[i] ? pair->value : 0;
+    }
+    bench_report("sorted array get", queries, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        pair_t *pair = h_btree_get(&tree, &keys[i]);
+        acc += pair ? pair->value : 0;
+    }
+    bench_report("btree get, u64 keys", queries, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        pair_t *pair = h_btree_get(&custom, &keys[i]);
+        acc += pair ? pair->value : 0;
+    }
+    bench_report("btree get, comparator", queries, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) acc += array_lower_bound(pairs, n, keys[i])->value;
+    bench_report("sorted array lower_bound", queries, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        pair_t *pair = h_btree_lower_bound(&tree, &keys[i]);
+        acc += pair ? pair->value : 0;
+    }
+    bench_report("btree lower_bound", queries, bench_now() - t0);
+
+    size_t scanned = 0;
+    t0 = bench_now();
+    for (size_t i=0;i<queries / 16;++i) {
+        u64 hi = keys[i] + 2 * scan;
+        pair_t const *end = pairs + n;
+        for (pair_t const *pair = array_lower_bound(pairs, n, keys[i]);pair < end && pair->key < hi;++pair, ++scanned)
+            acc += pair->value;
+    }
+    bench_report("sorted array range scan", scanned, bench_now() - t0);
+    scanned = 0;
+    t0 = bench_now();
+    for (size_t i=0;i<queries / 16;++i) {
+        u64 hi = keys[i] + 2 * scan;
+        h_btree_cursor_t cursor = h_btree_range(&tree, &keys[i], &hi);
+        for (pair_t *pair;(pair = h_btree_next(&cursor));++scanned) acc += pair->value;
+    }
+    bench_report("btree range scan", scanned, bench_now() - t0);
+
+    BENCH_KEEP(acc);
+    free(keys);
+    h_btree_free(&custom);
+    h_btree_free(&tree);
+    h_array_free(&sorted);
+    return 0;
+}
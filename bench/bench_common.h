@@ -0,0 +1,37 @@
+/*
+ *  Small timing helpers shared by the benchmark programs.
+ */
+
+#ifndef HCLIB_BENCH_COMMON_H
+#define HCLIB_BENCH_COMMON_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <time.h>
+
+static inline double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// keeps the compiler from optimizing a computed value away
+#define BENCH_KEEP(v) __asm__ volatile("" : : "g"(v) : "memory")
+// forces memory to be treated as changed, so pure calls aren't hoisted out of repeat loops
+#define BENCH_CLOBBER() ({ __asm__ volatile("" : : : "memory"); })
+
+static inline size_t bench_arg(int argc, char **argv, int i, size_t def) {
+    return argc > i ? (size_t)strtoull(argv[i], NULL, 10) : def;
+}
+
+static inline void bench_report(char const *name, size_t ops, double seconds) {
+    printf("%-40s %12zu ops %10.3f ms %10.2f ns/op\n", name, ops, seconds * 1e3, seconds * 1e9 / (double)ops);
+}
+
+static inline void bench_report_bytes(char const *name, size_t bytes, double seconds) {
+    printf("%-40s %12zu B   %10.3f ms %10.2f GB/s\n", name, bytes, seconds * 1e3, (double)bytes / seconds * 1e-9);
+}
+
+#endif //HCLIB_BENCH_COMMON_H
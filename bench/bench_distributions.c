@@ -0,0 +1,96 @@
+/*
+ *  Non-uniform sampling throughput : ziggurat normal/exponential against Box-Muller and
+ *  inversion baselines, Poisson, alias table choice against a linear CDF scan, and the cost
+ *  of handing out substreams.
+ *
+ *  usage : bench_distributions [count] [categories]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 1 << 22);
+    size_t ncat = bench_arg(argc, argv, 2, 256);
+
+    f64 *d = malloc(n * sizeof(f64));
+    u32 *u = malloc(n * sizeof(u32));
+    h_rng_t rng = h_create_rng(0x5eed);
+
+    double t0 = bench_now();
+    h_rng_fill_normal(&rng, d, n, 0.0, 1.0);
+    bench_report("normal (ziggurat)", n, bench_now() - t0);
+    BENCH_KEEP(d[n - 1]);
+
+    t0 = bench_now();
+    for (size_t i=0;i+1<n;i+=2) {
+        f64 r = sqrt(-2.0 * log(1.0 - h_rng_next_f64(&rng)));
+        f64 theta = 2.0 * 3.14159265358979323846 * h_rng_next_f64(&rng);
+        d[i] = r * cos(theta);
+        d[i + 1] = r * sin(theta);
+    }
+    bench_report("normal (Box-Muller baseline)", n, bench_now() - t0);
+    BENCH_KEEP(d[n - 1]);
+
+    t0 = bench_now();
+    h_rng_fill_exponential(&rng, d, n, 1.0);
+    bench_report("exponential (ziggurat)", n, bench_now() - t0);
+    BENCH_KEEP(d[n - 1]);
+
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) d[i] = -log(1.0 - h_rng_next_f64(&rng));
+    bench_report("exponential (inversion baseline)", n, bench_now() - t0);
+    BENCH_KEEP(d[n - 1]);
+
+    f64 lambdas[] = {4.0, 100.0};
+    for (int l=0;l<2;++l) {
+        char name[64];
+        snprintf(name, sizeof(name), "poisson (lambda %.0f)", lambdas[l]);
+        t0 = bench_now();
+        h_rng_fill_poisson(&rng, u, n, lambdas[l]);
+        bench_report(name, n, bench_now() - t0);
+        BENCH_KEEP(u[n - 1]);
+    }
+
+    f64 *weights = malloc(ncat * sizeof(f64));
+    f64 *cdf = malloc(ncat * sizeof(f64));
+    f64 total = 0.0;
+    for (size_t i=0;i<ncat;++i) {
+        weights[i] = 1.0 / (f64)(i + 1);
+        total += weights[i];
+        cdf[i] = total;
+    }
+    h_alias_table_t table = h_create_alias_table(weights, ncat);
+    t0 = bench_now();
+    h_alias_fill(&table, &rng, u, n);
+    bench_report("weighted choice (alias table)", n, bench_now() - t0);
+    BENCH_KEEP(u[n - 1]);
+
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) {
+        f64 x = h_rng_next_f64(&rng) * total;
+        u32 c = 0;
+        while (c + 1 < ncat && cdf[c] <= x) c++;
+        u[i] = c;
+    }
+    bench_report("weighted choice (linear CDF baseline)", n, bench_now() - t0);
+    BENCH_KEEP(u[n - 1]);
+
+    size_t nstreams = 1024;
+    h_rng_t *streams = malloc(nstreams * sizeof(h_rng_t));
+    t0 = bench_now();
+    h_rng_split(&rng, streams, nstreams);
+    bench_report("h_rng_split (per stream)", nstreams, bench_now() - t0);
+    BENCH_KEEP(streams[nstreams - 1].s[0]);
+
+    free(streams);
+    h_alias_table_free(&table);
+    free(weights);
+    free(cdf);
+    free(d);
+    free(u);
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ *  Reading a delimited file : fgets + h_split_string versus h_file_reader_t over mmap and over
+ *  a pipe (chunked read), both splitting fields with h_split_fields.
+ *
+ *  usage : bench_file_reader [file_megabytes] [path]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+#define MAX_FIELDS 64
+
+int main(int argc, char **argv) {
+    size_t megabytes = bench_arg(argc, argv, 1, 64);
+    char const *path = argc > 2 ? argv[2] : "/tmp/hclib_bench_reader.csv";
+
+    // CSV rows of 8 fields
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        perror(path);
+        return 1;
+    }
+    h_rng_t rng = h_create_rng(11);
+    size_t bytes = 0;
+    while (bytes < megabytes << 20) {
+        char line[256];
+        int n = snprintf(line, sizeof(line), "%u,%u,user_%u,%u.%02u,%s,%u,%u,tag%u\n",
+            h_rng_next_u32(&rng), h_rng_bounded_u32(&rng, 1000), h_rng_bounded_u32(&rng, 100000),
+            h_rng_bounded_u32(&rng, 10000), h_rng_bounded_u32(&rng, 100), h_rng_bounded_u32(&rng, 2) ? "GET" : "POST",
+            h_rng_bounded_u32(&rng, 600), h_rng_bounded_u32(&rng, 1 << 20), h_rng_bounded_u32(&rng, 50));
+        fwrite(line, 1, (size_t)n, file);
+        bytes += (size_t)n;
+    }
+    fclose(file);
+
+    size_t fields = 0;
+    double t0 = bench_now();
+    file = fopen(path, "r");
+    char line[4096];
+    while (fgets(line, sizeof(line), file)) {
+        line[strcspn(line, "\n")] = 0;
+        h_array_t tokens = h_split_string(h_tostring(line), ',');
+        fields += tokens.size - 1;
+        for (size_t i=0;i+1<tokens.size;++i) free(H_ARRAY_GET(h_string_t, tokens, i).cstr);
+        h_array_free(&tokens);
+    }
+    fclose(file);
+    bench_report_bytes("fgets + h_split_string", bytes, bench_now() - t0);
+
+    h_string_view_t out[MAX_FIELDS];
+    t0 = bench_now();
+    h_file_reader_t reader = h_file_reader_open(path, '\n');
+    h_string_view_t record;
+    while (h_file_reader_next(&reader, &record)) fields += h_split_fields(record, ',', out, MAX_FIELDS);
+    h_file_reader_close(&reader);
+    bench_report_bytes("h_file_reader (mmap) + h_split_fields", bytes, bench_now() - t0);
+
+    char command[512];
+    snprintf(command, sizeof(command), "cat '%s'", path);
+    t0 = bench_now();
+    FILE *pipe = popen(command, "r");
+    reader = h_file_reader_from_fd(fileno(pipe), '\n');
+    while (h_file_reader_next(&reader, &record)) fields += h_split_fields(record, ',', out, MAX_FIELDS);
+    h_file_reader_close(&reader);
+    pclose(pipe);
+    bench_report_bytes("h_file_reader (pipe) + h_split_fields", bytes, bench_now() - t0);
+
+    BENCH_KEEP(fields);
+    remove(path);
+    return 0;
+}
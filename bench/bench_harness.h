@@ -0,0 +1,249 @@
+/*
+ *  Repeated-run harness for bench_suite : every case runs a few discarded warmup rounds, then
+ *  timed rounds whose ns/op are reduced to min, median, p99 and mean. On Linux, hardware counters
+ *  (cycles, instructions, cache and branch misses) are read around the timed region through
+ *  perf_event_open when asked for, and simply reported as missing when the kernel refuses.
+ *  Results can be written as JSON, each case naming the baseline case it is measured against.
+ *
+ *  A case is a function called once per round, doing its setup, then timing its work between
+ *  bench_start and bench_stop.
+ */
+
+#ifndef HCLIB_BENCH_HARNESS_H
+#define HCLIB_BENCH_HARNESS_H
+
+#include "bench_common.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+enum {
+    BENCH_CYCLES,
+    BENCH_INSTRUCTIONS,
+    BENCH_CACHE_MISSES,
+    BENCH_BRANCH_MISSES,
+    BENCH_NCOUNTERS
+};
+
+static char const *const bench_counter_names[BENCH_NCOUNTERS] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+
+#define BENCH_MAX_RESULTS 256
+
+typedef struct bench_result_t {
+    char const *module;
+    char const *name;
+    char const *baseline;
+    size_t ops;
+    double min, median, p99, mean;              // ns per op
+    double counters[BENCH_NCOUNTERS];           // median per op, negative when unavailable
+} bench_result_t;
+
+typedef struct bench_t {
+    size_t size;
+    size_t warmup;
+    size_t runs;
+    char const *filter;
+    FILE *log;                                  // text report, stdout unless JSON goes there
+
+    int fds[BENCH_NCOUNTERS];                   // group led by fds[0], -1 when not opened
+    bool counters;
+
+    // current case
+    size_t round;
+    size_t ops;
+    double start;
+    double *ns;
+    double *counts;                             // runs x BENCH_NCOUNTERS, per op
+
+    bench_result_t results[BENCH_MAX_RESULTS];
+    size_t nresults;
+    uint64_t sink;                              // cases fold their outputs in here
+} bench_t;
+
+typedef void (bench_case_fn_t)(bench_t *b, size_t n);
+
+#ifdef __linux__
+static int bench_perf_open(uint64_t config, int group) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group == -1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+#endif
+
+// false when no counter could be opened, the harness then only times
+static bool bench_counters_open(bench_t *b) {
+    for (int c=0;c<BENCH_NCOUNTERS;++c) b->fds[c] = -1;
+#ifdef __linux__
+    static uint64_t const configs[BENCH_NCOUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    b->fds[0] = bench_perf_open(configs[0], -1);
+    if (b->fds[0] < 0) return b->counters = false;
+    for (int c=1;c<BENCH_NCOUNTERS;++c) b->fds[c] = bench_perf_open(configs[c], b->fds[0]);
+    return b->counters = true;
+#else
+    return b->counters = false;
+#endif
+}
+
+static void bench_counters_close(bench_t *b) {
+#ifdef __linux__
+    for (int c=BENCH_NCOUNTERS-1;c>=0;--c) if (b->fds[c] >= 0) close(b->fds[c]);
+#endif
+    for (int c=0;c<BENCH_NCOUNTERS;++c) b->fds[c] = -1;
+    b->counters = false;
+}
+
+static inline void bench_start(bench_t *b) {
+#ifdef __linux__
+    if (b->counters) {
+        ioctl(b->fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(b->fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+    b->start = bench_now();
+}
+
+static inline void bench_stop(bench_t *b, size_t ops) {
+    double elapsed = bench_now() - b->start;
+#ifdef __linux__
+    uint64_t values[1 + BENCH_NCOUNTERS] = {0};
+    if (b->counters) {
+        ioctl(b->fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        if (read(b->fds[0], values, sizeof(values)) < (ssize_t)sizeof(uint64_t)) values[0] = 0;
+    }
+#endif
+    if (b->round < b->warmup) return;
+
+    size_t run = b->round - b->warmup;
+    b->ops = ops ? ops : 1;
+    b->ns[run] = elapsed * 1e9 / (double)b->ops;
+    // group values come in opening order, skipping members that failed to open
+    for (int c=0,v=1;c<BENCH_NCOUNTERS;++c) {
+        double count = -1.0;
+#ifdef __linux__
+        if (b->counters && b->fds[c] >= 0 && (uint64_t)v <= values[0]) count = (double)values[v++] / (double)b->ops;
+#endif
+        b->counts[run * BENCH_NCOUNTERS + c] = count;
+    }
+}
+
+static int bench_cmp_double(void const *a, void const *b) {
+    double x = *(double const*)a, y = *(double const*)b;
+    return (x > y) - (x < y);
+}
+
+static double bench_median(double *v, size_t n) {
+    qsort(v, n, sizeof(double), bench_cmp_double);
+    return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) * 0.5;
+}
+
+static bench_result_t const *bench_find(bench_t const *b, char const *name) {
+    for (size_t i=0;i<b->nresults;++i)
+        if (!strcmp(b->results[i].name, name)) return &b->results[i];
+    return NULL;
+}
+
+// Runs fn warmup + runs times, baseline names an earlier case (or NULL)
+static void bench_case(bench_t *b, char const *module, char const *name, char const *baseline, bench_case_fn_t *fn) {
+    char full[256];
+    snprintf(full, sizeof(full), "%s/%s", module, name);
+    if (b->filter && !strstr(full, b->filter)) return;
+    if (b->nresults == BENCH_MAX_RESULTS) return;
+
+    b->ns = calloc(b->runs, sizeof(double));
+    b->counts = calloc(b->runs * BENCH_NCOUNTERS, sizeof(double));
+    b->ops = 1;
+    for (b->round=0;b->round<b->warmup+b->runs;++b->round) fn(b, b->size);
+
+    bench_result_t *r = &b->results[b->nresults++];
+    *r = (bench_result_t){module, name, baseline, b->ops, 0, 0, 0, 0, {0}};
+    for (size_t i=0;i<b->runs;++i) r->mean += b->ns[i] / (double)b->runs;
+    r->median = bench_median(b->ns, b->runs);
+    r->min = b->ns[0];
+    size_t rank = (size_t)ceil(0.99 * (double)b->runs);
+    r->p99 = b->ns[(rank ? rank : 1) - 1];
+
+    double *column = malloc(b->runs * sizeof(double));
+    for (int c=0;c<BENCH_NCOUNTERS;++c) {
+        for (size_t i=0;i<b->runs;++i) column[i] = b->counts[i * BENCH_NCOUNTERS + c];
+        r->counters[c] = bench_median(column, b->runs);
+    }
+    free(column);
+    free(b->ns);
+    free(b->counts);
+
+    fprintf(b->log, "%-12s %-34s %10.2f ns/op  p99 %10.2f", module, name, r->median, r->p99);
+    if (r->counters[BENCH_CYCLES] >= 0) fprintf(b->log, "  %8.1f cyc/op", r->counters[BENCH_CYCLES]);
+    if (r->counters[BENCH_CACHE_MISSES] >= 0) fprintf(b->log, "  %7.3f miss/op", r->counters[BENCH_CACHE_MISSES]);
+    bench_result_t const *base = baseline ? bench_find(b, baseline) : NULL;
+    if (base && r->median > 0) fprintf(b->log, "  x%.2f vs %s", base->median / r->median, baseline);
+    fprintf(b->log, "\n");
+    fflush(b->log);
+}
+
+static void bench_json_string(FILE *f, char const *str) {
+    fputc('"', f);
+    for (;*str;++str) {
+        if (*str == '"' || *str == '\\') fputc('\\', f);
+        fputc(*str, f);
+    }
+    fputc('"', f);
+}
+
+static void bench_write_json(bench_t const *b, FILE *f) {
+    fprintf(f, "{\n  \"config\": {\"size\": %zu, \"warmup\": %zu, \"runs\": %zu, \"counters\": %s, \"timestamp\": %lld, \"compiler\": ",
+        b->size, b->warmup, b->runs, b->counters ? "true" : "false", (long long)time(NULL));
+#ifdef __VERSION__
+    bench_json_string(f, __VERSION__);
+#else
+    bench_json_string(f, "unknown");
+#endif
+#ifdef __AVX2__
+    fprintf(f, ", \"avx2\": true},\n");
+#else
+    fprintf(f, ", \"avx2\": false},\n");
+#endif
+    fprintf(f, "  \"results\": [\n");
+    for (size_t i=0;i<b->nresults;++i) {
+        bench_result_t const *r = &b->results[i];
+        fprintf(f, "    {\"module\": ");
+        bench_json_string(f, r->module);
+        fprintf(f, ", \"name\": ");
+        bench_json_string(f, r->name);
+        fprintf(f, ", \"ops\": %zu, \"ns_per_op\": {\"min\": %.3f, \"median\": %.3f, \"p99\": %.3f, \"mean\": %.3f}",
+            r->ops, r->min, r->median, r->p99, r->mean);
+        fprintf(f, ", \"counters_per_op\": {");
+        for (int c=0;c<BENCH_NCOUNTERS;++c) {
+            fprintf(f, "%s\"%s\": ", c ? ", " : "", bench_counter_names[c]);
+            if (r->counters[c] >= 0) fprintf(f, "%.4f", r->counters[c]);
+            else fprintf(f, "null");
+        }
+        fprintf(f, "}, \"baseline\": ");
+        bench_result_t const *base = r->baseline ? bench_find(b, r->baseline) : NULL;
+        if (base) {
+            bench_json_string(f, r->baseline);
+            fprintf(f, ", \"speedup\": %.4f", r->median > 0 ? base->median / r->median : 0.0);
+        }
+        else fprintf(f, "null");
+        fprintf(f, "}%s\n", i + 1 < b->nresults ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+#endif //HCLIB_BENCH_HARNESS_H
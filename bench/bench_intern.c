@@ -0,0 +1,109 @@
+/*
+ *  String interning : intern throughput (first sighting and repeat), the shared interner
+ *  across threads, memory footprint, and h_hashmap_get keyed on symbol ids versus h_string_t keys.
+ *
+ *  usage : bench_intern [distinct_keys] [nthreads]
+ */
+
+#include "bench_common.h"
+#include <pthread.h>
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+typedef struct string_pair_t {
+    h_string_t key;
+    u32 value;
+} string_pair_t;
+
+typedef struct symbol_pair_t {
+    u32 key;
+    u32 value;
+} symbol_pair_t;
+
+static u32 string_hash_ptr(void *pair) {
+    h_string_t *str = (h_string_t*)pair;
+    return h_hash_bytes(str->cstr, str->size);
+}
+
+static size_t nkeys, nthreads;
+static h_string_view_t *keys;
+static h_shared_interner_t *shared;
+
+static void *shared_worker(void *arg) {
+    size_t tid = (size_t)arg;
+    u32 acc = 0;
+    for (size_t i=0;i<nkeys;++i) acc += h_shared_intern(shared, keys[(i + tid * 7919) % nkeys]);
+    BENCH_KEEP(acc);
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    nkeys = bench_arg(argc, argv, 1, 1 << 18);
+    nthreads = bench_arg(argc, argv, 2, 4);
+
+    keys = malloc(nkeys * sizeof(h_string_view_t));
+    size_t key_bytes = 0;
+    for (size_t i=0;i<nkeys;++i) {
+        char buf[64];
+        int n = snprintf(buf, sizeof(buf), "config.section_%zu.key_%zu", i % 97, i);
+        keys[i] = h_string_view(h_string_view_dup((h_string_view_t){buf, (size_t)n}));
+        key_bytes += (size_t)n + 1;
+    }
+
+    h_interner_t interner = h_create_interner(16);
+    double t0 = bench_now();
+    for (size_t i=0;i<nkeys;++i) h_intern(&interner, keys[i]);
+    bench_report("h_intern (first sighting)", nkeys, bench_now() - t0);
+
+    t0 = bench_now();
+    u32 acc = 0;
+    for (size_t i=0;i<nkeys;++i) acc += h_intern(&interner, keys[i]);
+    bench_report("h_intern (already interned)", nkeys, bench_now() - t0);
+    BENCH_KEEP(acc);
+
+    shared = h_shared_interner_create(nkeys);
+    pthread_t *threads = malloc(nthreads * sizeof(pthread_t));
+    t0 = bench_now();
+    for (size_t t=0;t<nthreads;++t) pthread_create(&threads[t], NULL, shared_worker, (void*)t);
+    for (size_t t=0;t<nthreads;++t) pthread_join(threads[t], NULL);
+    bench_report("h_shared_intern (all threads)", nkeys * nthreads, bench_now() - t0);
+    free(threads);
+    h_shared_interner_destroy(shared);
+
+    // strdup per key as h_string_t keyed maps do it today, 16 bytes of malloc header assumed
+    size_t strdup_bytes = key_bytes + nkeys * (16 + sizeof(h_string_t));
+    printf("memory : interner %zu B, strdup'd h_string_t keys ~%zu B\n", h_interner_memory(&interner), strdup_bytes);
+
+    h_hashmap_t by_string = H_CREATE_HASHMAP(string_pair_t, nkeys, string_hash_ptr, h_string_eq_ptr);
+    h_hashmap_t by_symbol = H_CREATE_HASHMAP(symbol_pair_t, nkeys, h_symbol_hash_ptr, h_symbol_eq_ptr);
+    for (size_t i=0;i<nkeys;++i) {
+        string_pair_t sp = {{(h_cstr_t)keys[i].data, keys[i].size}, (u32)i};
+        symbol_pair_t yp = {h_intern(&interner, keys[i]), (u32)i};
+        h_hashmap_put(&by_string, &sp);
+        h_hashmap_put(&by_symbol, &yp);
+    }
+
+    t0 = bench_now();
+    for (size_t i=0;i<nkeys;++i) {
+        h_string_t key = {(h_cstr_t)keys[(i * 31) % nkeys].data, keys[(i * 31) % nkeys].size};
+        acc += ((string_pair_t*)h_hashmap_get(&by_string, &key))->value;
+    }
+    bench_report("h_hashmap_get (h_string_t key)", nkeys, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t i=0;i<nkeys;++i) {
+        u32 key = (u32)((i * 31) % nkeys);
+        acc += ((symbol_pair_t*)h_hashmap_get(&by_symbol, &key))->value;
+    }
+    bench_report("h_hashmap_get (symbol id key)", nkeys, bench_now() - t0);
+    BENCH_KEEP(acc);
+
+    h_hashmap_free(&by_string);
+    h_hashmap_free(&by_symbol);
+    h_interner_free(&interner);
+    for (size_t i=0;i<nkeys;++i) free((void*)keys[i].data);
+    free(keys);
+    return 0;
+}
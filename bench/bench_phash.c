@@ -0,0 +1,117 @@
+/*
+ *  Static key sets : tables generated by tools/phash_gen (http_headers_phash.h for strings,
+ *  opcodes_phash.h for integers) and a runtime built h_phash_t, against h_hashmap_get.
+ *  Queries are 90% hits, misses are near-miss strings or unknown ids.
+ *
+ *  usage : bench_phash [queries]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+#include "http_headers_phash.h"
+#include "opcodes_phash.h"
+
+typedef struct header_pair_t {
+    char const *key;
+    size_t size;
+    int value;
+} header_pair_t;
+
+typedef struct opcode_pair_t {
+    u32 key;
+    u32 value;
+} opcode_pair_t;
+
+static u32 header_hash(void *pair) {
+    header_pair_t *header = (header_pair_t*)pair;
+    return h_hash_bytes(header->key, header->size);
+}
+static bool header_eq(void *key, void *pair) {
+    header_pair_t *a = (header_pair_t*)key, *b = (header_pair_t*)pair;
+    return a->size == b->size && memcmp(a->key, b->key, a->size) == 0;
+}
+static u32 opcode_hash(void *pair) {
+    return h_pcg_hash(*(u32*)pair);
+}
+static bool opcode_eq(void *key, void *pair) {
+    return *(u32*)key == *(u32*)pair;
+}
+
+int main(int argc, char **argv) {
+    size_t queries = bench_arg(argc, argv, 1, 1 << 22);
+    h_rng_t rng = h_create_rng(21);
+
+    // both key sets, taken back out of the generated tables
+    char const *headers[HTTP_HEADERS_COUNT];
+    size_t sizes[HTTP_HEADERS_COUNT];
+    u32 opcodes[OPCODES_COUNT];
+    size_t nheaders = 0, nopcodes = 0;
+    for (size_t s=0;s<sizeof(http_headers_table) / sizeof(*http_headers_table);++s) {
+        if (!http_headers_table[s].key) continue;
+        headers[nheaders] = http_headers_table[s].key;
+        sizes[nheaders++] = http_headers_table[s].size;
+    }
+    for (size_t s=0;s<sizeof(opcodes_table) / sizeof(*opcodes_table);++s)
+        if (opcodes_table[s].used) opcodes[nopcodes++] = opcodes_table[s].key;
+
+    h_hashmap_t header_map = H_CREATE_HASHMAP(header_pair_t, 2 * nheaders, header_hash, header_eq);
+    for (size_t i=0;i<nheaders;++i) h_hashmap_put(&header_map, &(header_pair_t){headers[i], sizes[i], (int)i});
+    h_hashmap_t opcode_map = H_CREATE_HASHMAP(opcode_pair_t, 2 * nopcodes, opcode_hash, opcode_eq);
+    for (size_t i=0;i<nopcodes;++i) h_hashmap_put(&opcode_map, &(opcode_pair_t){opcodes[i], (u32)i});
+    h_phash_t runtime = h_create_phash_bytes((void const*const*)headers, sizes, (u32)nheaders);
+
+    // misses drop the last character of a known header
+    header_pair_t *header_queries = malloc(queries * sizeof(header_pair_t));
+    u32 *opcode_queries = malloc(queries * sizeof(u32));
+    for (size_t i=0;i<queries;++i) {
+        u32 h = h_rng_bounded_u32(&rng, (u32)nheaders);
+        bool miss = h_rng_bounded_u32(&rng, 10) == 0;
+        header_queries[i] = (header_pair_t){headers[h], sizes[h] - miss, 0};
+        opcode_queries[i] = miss ? h_rng_next_u32(&rng) | 0x80000000u : opcodes[h_rng_bounded_u32(&rng, (u32)nopcodes)];
+    }
+
+    u64 acc = 0;
+    double t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        http_headers_entry_t const *entry = http_headers_find(header_queries[i].key, header_queries[i].size);
+        acc += entry ? (u64)entry->value : 0;
+    }
+    bench_report("headers, generated table", queries, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        u32 idx = h_phash_lookup(&runtime, h_phash_hash_bytes(header_queries[i].key, header_queries[i].size, runtime.seed));
+        if (idx != H_PHASH_EMPTY && sizes[idx] == header_queries[i].size && memcmp(headers[idx], header_queries[i].key, sizes[idx]) == 0) acc += idx;
+    }
+    bench_report("headers, runtime h_phash_t", queries, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        header_pair_t *pair = h_hashmap_get(&header_map, &header_queries[i]);
+        acc += pair ? (u64)pair->value : 0;
+    }
+    bench_report("headers, h_hashmap_get", queries, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        opcodes_entry_t const *entry = opcodes_find(opcode_queries[i]);
+        acc += entry ? entry->value : 0;
+    }
+    bench_report("opcodes, generated table", queries, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<queries;++i) {
+        opcode_pair_t *pair = h_hashmap_get(&opcode_map, &opcode_queries[i]);
+        acc += pair ? pair->value : 0;
+    }
+    bench_report("opcodes, h_hashmap_get", queries, bench_now() - t0);
+
+    BENCH_KEEP(acc);
+    free(header_queries);
+    free(opcode_queries);
+    h_phash_free(&runtime);
+    h_hashmap_free(&opcode_map);
+    h_hashmap_free(&header_map);
+    return 0;
+}
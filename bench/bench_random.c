@@ -0,0 +1,61 @@
+/*
+ *  Random generation throughput in GB/s : h_randf in a loop versus the stateful h_rng_t
+ *  generator, one value at a time and through the bulk fills.
+ *
+ *  usage : bench_random [count] [repeats]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 1 << 22);
+    size_t repeats = bench_arg(argc, argv, 2, 8);
+    size_t bytes = n * repeats * sizeof(u32);
+
+    f32 *f = malloc(n * sizeof(f32));
+    u32 *u = malloc(n * sizeof(u32));
+    h_rng_t rng = h_create_rng(0x5eed);
+
+    double t0 = bench_now();
+    for (size_t r=0;r<repeats;++r)
+        for (size_t i=0;i<n;++i) f[i] = h_randf((u32)(r * n + i));
+    bench_report_bytes("h_randf loop", bytes, bench_now() - t0);
+    BENCH_KEEP(f[n - 1]);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r)
+        for (size_t i=0;i<n;++i) f[i] = h_rng_next_f32(&rng);
+    bench_report_bytes("h_rng_next_f32 loop", bytes, bench_now() - t0);
+    BENCH_KEEP(f[n - 1]);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r)
+        for (size_t i=0;i<n;++i) u[i] = h_rng_next_u32(&rng);
+    bench_report_bytes("h_rng_next_u32 loop", bytes, bench_now() - t0);
+    BENCH_KEEP(u[n - 1]);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r) h_rng_fill_f32(&rng, f, n);
+    bench_report_bytes("h_rng_fill_f32", bytes, bench_now() - t0);
+    BENCH_KEEP(f[n - 1]);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r) h_rng_fill_u32(&rng, u, n);
+    bench_report_bytes("h_rng_fill_u32", bytes, bench_now() - t0);
+    BENCH_KEEP(u[n - 1]);
+
+    t0 = bench_now();
+    u32 acc = 0;
+    for (size_t r=0;r<repeats;++r)
+        for (size_t i=0;i<n;++i) acc += h_rng_bounded_u32(&rng, 1000003);
+    bench_report_bytes("h_rng_bounded_u32 loop", bytes, bench_now() - t0);
+    BENCH_KEEP(acc);
+
+    free(f);
+    free(u);
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ *  Blocked Bloom filter and count-min sketch throughput, plus the measured false positive rate.
+ *  The Bloom query is compared against a h_hashmap_get on the same keys.
+ *
+ *  usage : bench_sketch [nkeys] [fp_rate_per_million]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+static u32 key_hash(void *pair) { return h_pcg_hash(*(u32*)pair); }
+static bool key_eq(void *key, void *pair) { return *(u32*)key == *(u32*)pair; }
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 1 << 20);
+    double fp_rate = (double)bench_arg(argc, argv, 2, 10000) * 1e-6;
+
+    u32 *hashes = malloc(n * sizeof(u32));
+    u32 *absent = malloc(n * sizeof(u32));
+    u64 *keys = malloc(n * sizeof(u64));
+    u64 *absent_keys = malloc(n * sizeof(u64));
+    bool *out = malloc(n * sizeof(bool));
+    for (size_t i=0;i<n;++i) {
+        hashes[i] = h_pcg_hash((u32)i);
+        absent[i] = h_pcg_hash((u32)(i + n));
+        u64 id = i, absent_id = i + n;
+        keys[i] = h_hash_bytes64(&id, sizeof(id));
+        absent_keys[i] = h_hash_bytes64(&absent_id, sizeof(absent_id));
+    }
+
+    h_bloom_t bloom = h_create_bloom(n, fp_rate);
+    double t0 = bench_now();
+    h_bloom_insert_batch(&bloom, keys, n);
+    bench_report("bloom insert batch", n, bench_now() - t0);
+
+    t0 = bench_now();
+    size_t hits = h_bloom_query_batch(&bloom, keys, n, out);
+    bench_report("bloom query batch (present)", n, bench_now() - t0);
+    if (hits != n) fprintf(stderr, "bloom : %zu false negatives\n", n - hits);
+
+    t0 = bench_now();
+    size_t fps = h_bloom_query_batch(&bloom, absent_keys, n, out);
+    bench_report("bloom query batch (absent)", n, bench_now() - t0);
+    printf("bloom : %zu blocks, target fp %.4f, measured fp %.4f\n", bloom.nblocks, fp_rate, (double)fps / (double)n);
+
+    h_hashmap_t map = H_CREATE_HASHMAP(u32, n, key_hash, key_eq);
+    for (size_t i=0;i<n;++i) h_hashmap_put(&map, &hashes[i]);
+    t0 = bench_now();
+    size_t found = 0;
+    for (size_t i=0;i<n;++i) found += h_hashmap_get(&map, &absent[i]) != NULL;
+    bench_report("h_hashmap_get (absent)", n, bench_now() - t0);
+    BENCH_KEEP(found);
+    h_hashmap_free(&map);
+
+    h_count_min_t sketch = h_create_count_min(1e-4, 1e-2);
+    // skewed stream : the product of two uniform draws favours low key indices
+    for (size_t i=0;i<n;++i) absent[i] = hashes[(size_t)(h_pcg_hash((u32)i) % 1024) * ((size_t)h_pcg_hash((u32)~i) % 1024) % n];
+    t0 = bench_now();
+    h_count_min_add_batch(&sketch, absent, n);
+    bench_report("count-min add batch", n, bench_now() - t0);
+    u32 *counts = malloc(n * sizeof(u32));
+    t0 = bench_now();
+    h_count_min_estimate_batch(&sketch, hashes, n, counts);
+    bench_report("count-min estimate batch", n, bench_now() - t0);
+    BENCH_KEEP(counts[0]);
+
+    free(counts);
+    h_count_min_free(&sketch);
+    h_bloom_free(&bloom);
+    free(hashes);
+    free(absent);
+    free(keys);
+    free(absent_keys);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ *  Stable handles : h_slot_map_t and h_sparse_set_t against h_hashmap_t keyed by integer id,
+ *  for lookup, churn (erase one, insert one at constant population) and dense iteration.
+ *  h_hashmap_remove rescans every bucket, keep churn_ops modest.
+ *
+ *  usage : bench_slot_map [live_objects] [churn_ops]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+typedef struct object_t {
+    f32 position[3];
+    f32 velocity[3];
+    u32 flags;
+    u32 id;
+} object_t;
+
+typedef struct object_pair_t {
+    u32 key;
+    object_t value;
+} object_pair_t;
+
+static u32 id_hash(void *pair) {
+    return h_pcg_hash(*(u32*)pair);
+}
+static bool id_eq(void *key, void *pair) {
+    return *(u32*)key == *(u32*)pair;
+}
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 1 << 18);
+    size_t churn = bench_arg(argc, argv, 2, 1 << 12);
+    h_rng_t rng = h_create_rng(3);
+
+    h_slot_map_t map = H_CREATE_SLOT_MAP(object_t, (u32)n);
+    h_sparse_set_t set = h_create_sparse_set(sizeof(object_t), (u32)n);
+    h_hashmap_t hashmap = H_CREATE_HASHMAP(object_pair_t, n, id_hash, id_eq);
+    h_handle_t *handles = malloc(n * sizeof(h_handle_t));
+    u32 *ids = malloc(n * sizeof(u32));
+
+    double t0 = bench_now();
+    for (size_t i=0;i<n;++i) handles[i] = h_slot_map_insert(&map, &(object_t){{0}, {1, 1, 1}, 0, (u32)i});
+    bench_report("slot map insert", n, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) h_sparse_set_insert(&set, (u32)i, &(object_t){{0}, {1, 1, 1}, 0, (u32)i});
+    bench_report("sparse set insert", n, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) h_hashmap_put(&hashmap, &(object_pair_t){(u32)i, {{0}, {1, 1, 1}, 0, (u32)i}});
+    bench_report("hashmap put", n, bench_now() - t0);
+    for (size_t i=0;i<n;++i) ids[i] = (u32)i;
+
+    u32 *order = malloc(n * sizeof(u32));
+    for (size_t i=0;i<n;++i) order[i] = h_rng_bounded_u32(&rng, (u32)n);
+
+    u64 acc = 0;
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) acc += H_SLOT_MAP_GET(object_t, map, handles[order[i]])->id;
+    bench_report("slot map get", n, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) acc += ((object_t*)h_sparse_set_get(&set, order[i]))->id;
+    bench_report("sparse set get", n, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) acc += ((object_pair_t*)h_hashmap_get(&hashmap, &order[i]))->value.id;
+    bench_report("hashmap get", n, bench_now() - t0);
+
+    // each op erases a random live object and inserts a replacement under a fresh id
+    u32 next_id = (u32)n;
+    t0 = bench_now();
+    for (size_t i=0;i<churn;++i) {
+        u32 victim = h_rng_bounded_u32(&rng, (u32)n);
+        h_slot_map_erase(&map, handles[victim]);
+        handles[victim] = h_slot_map_insert(&map, &(object_t){{0}, {1, 1, 1}, 0, next_id++});
+    }
+    bench_report("slot map churn", churn, bench_now() - t0);
+    next_id = (u32)n;
+    t0 = bench_now();
+    for (size_t i=0;i<churn;++i) {
+        u32 victim = h_rng_bounded_u32(&rng, (u32)n);
+        h_sparse_set_erase(&set, ids[victim]);
+        ids[victim] = next_id++;
+        h_sparse_set_insert(&set, ids[victim], &(object_t){{0}, {1, 1, 1}, 0, ids[victim]});
+    }
+    bench_report("sparse set churn", churn, bench_now() - t0);
+    for (size_t i=0;i<n;++i) ids[i] = (u32)i;
+    next_id = (u32)n;
+    t0 = bench_now();
+    for (size_t i=0;i<churn;++i) {
+        u32 victim = h_rng_bounded_u32(&rng, (u32)n);
+        h_hashmap_remove(&hashmap, &ids[victim]);
+        ids[victim] = next_id++;
+        h_hashmap_put(&hashmap, &(object_pair_t){ids[victim], {{0}, {1, 1, 1}, 0, ids[victim]}});
+    }
+    bench_report("hashmap churn", churn, bench_now() - t0);
+
+    // integrate positions over every live object, 10 passes
+    t0 = bench_now();
+    for (int pass=0;pass<10;++pass) {
+        object_t *objects = map.values;
+        for (u32 i=0;i<map.size;++i)
+            for (int k=0;k<3;++k) objects[i].position[k] += objects[i].velocity[k];
+        BENCH_CLOBBER();
+    }
+    bench_report("slot map iterate", 10 * map.size, bench_now() - t0);
+    t0 = bench_now();
+    for (int pass=0;pass<10;++pass) {
+        object_t *objects = set.values;
+        for (u32 i=0;i<set.size;++i)
+            for (int k=0;k<3;++k) objects[i].position[k] += objects[i].velocity[k];
+        BENCH_CLOBBER();
+    }
+    bench_report("sparse set iterate", 10 * set.size, bench_now() - t0);
+    // walking the hashmap by id, as callers without access to its pool do
+    t0 = bench_now();
+    for (int pass=0;pass<10;++pass) {
+        for (size_t i=0;i<n;++i) {
+            object_pair_t *pair = h_hashmap_get(&hashmap, &ids[i]);
+            for (int k=0;k<3;++k) pair->value.position[k] += pair->value.velocity[k];
+        }
+        BENCH_CLOBBER();
+    }
+    bench_report("hashmap iterate by id", 10 * n, bench_now() - t0);
+
+    BENCH_KEEP(acc);
+    free(order);
+    free(ids);
+    free(handles);
+    h_hashmap_free(&hashmap);
+    h_sparse_set_free(&set);
+    h_slot_map_free(&map);
+    return 0;
+}
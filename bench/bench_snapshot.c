@@ -0,0 +1,95 @@
+/*
+ *  Cold start of a u64 -> u64 lookup table : rebuilding the h_hashmap_t from source data versus
+ *  mapping a snapshot of it, with and without payload verification. The snapshot file is
+ *  evicted from the page cache (posix_fadvise) before each open to approximate a fresh boot.
+ *
+ *  usage : bench_snapshot [pairs] [lookups] [path]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+typedef struct pair_t {
+    u64 key;
+    u64 value;
+} pair_t;
+
+static u32 pair_hash(void *pair) {
+    return h_hash_bytes(pair, sizeof(u64));
+}
+static bool pair_eq(void *key, void *pair) {
+    return *(u64*)key == ((pair_t*)pair)->key;
+}
+
+static void evict(char const *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return;
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+}
+
+static u64 lookups(h_hashmap_t *map, size_t pairs, size_t n) {
+    h_rng_t rng = h_create_rng(5);
+    u64 sum = 0;
+    for (size_t i=0;i<n;++i) {
+        u64 key = h_rng_bounded_u64(&rng, pairs) * 0x9e3779b97f4a7c15ull;
+        pair_t *pair = h_hashmap_get(map, &key);
+        sum += pair ? pair->value : 0;
+    }
+    return sum;
+}
+
+int main(int argc, char **argv) {
+    size_t pairs = bench_arg(argc, argv, 1, 1 << 22);
+    size_t n = bench_arg(argc, argv, 2, 1 << 20);
+    char const *path = argc > 3 ? argv[3] : "/tmp/hclib_bench.snap";
+
+    double t0 = bench_now();
+    h_hashmap_t map = H_CREATE_HASHMAP(pair_t, pairs, pair_hash, pair_eq);
+    for (size_t i=0;i<pairs;++i) h_hashmap_put(&map, &(pair_t){i * 0x9e3779b97f4a7c15ull, i});
+    bench_report("rebuild from source", pairs, bench_now() - t0);
+
+    t0 = bench_now();
+    if (!h_hashmap_save(&map, path)) {
+        perror(path);
+        return 1;
+    }
+    bench_report("h_hashmap_save", pairs, bench_now() - t0);
+
+    u64 expected = lookups(&map, pairs, n);
+    t0 = bench_now();
+    BENCH_KEEP(lookups(&map, pairs, n));
+    bench_report("get, heap map", n, bench_now() - t0);
+
+    evict(path);
+    t0 = bench_now();
+    h_snapshot_t snapshot = h_snapshot_open(path, false);
+    h_hashmap_t loaded = h_snapshot_hashmap(&snapshot, pair_hash, pair_eq);
+    double open_sec = bench_now() - t0;
+    bench_report("h_snapshot_open", 1, open_sec);
+    t0 = bench_now();
+    u64 sum = lookups(&loaded, pairs, n);
+    bench_report("get, cold mapping", n, bench_now() - t0);
+    t0 = bench_now();
+    BENCH_KEEP(lookups(&loaded, pairs, n));
+    bench_report("get, warm mapping", n, bench_now() - t0);
+    h_snapshot_close(&snapshot);
+    if (sum != expected) {
+        fprintf(stderr, "snapshot lookups disagree with the heap map\n");
+        return 1;
+    }
+
+    evict(path);
+    t0 = bench_now();
+    snapshot = h_snapshot_open(path, true);
+    bench_report("h_snapshot_open, verified", 1, bench_now() - t0);
+    h_snapshot_close(&snapshot);
+
+    h_hashmap_free(&map);
+    remove(path);
+    return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ *  Splitting a long delimited line : h_split_string (strdup + strtok per token) versus
+ *  h_split_view (one array of views) and the allocation free h_split_iter.
+ *
+ *  usage : bench_split [line_bytes] [repeats]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+int main(int argc, char **argv) {
+    size_t bytes = bench_arg(argc, argv, 1, 1 << 20);
+    size_t repeats = bench_arg(argc, argv, 2, 20);
+
+    // fields of 1 to 16 characters
+    h_rng_t rng = h_create_rng(1);
+    char *line = malloc(bytes + 1);
+    for (size_t i=0;i<bytes;) {
+        size_t len = 1 + h_rng_bounded_u32(&rng, 16);
+        for (size_t j=0;j<len && i<bytes;++j) line[i++] = (char)('a' + h_rng_bounded_u32(&rng, 26));
+        if (i < bytes) line[i++] = ',';
+    }
+    line[bytes] = 0;
+    h_string_t str = h_tostring(line);
+
+    double t0 = bench_now();
+    size_t fields = 0;
+    for (size_t r=0;r<repeats;++r) {
+        h_array_t tokens = h_split_string(str, ',');
+        fields += tokens.size;
+        for (size_t i=0;i<tokens.size;++i) free(H_ARRAY_GET(h_string_t, tokens, i).cstr);
+        h_array_free(&tokens);
+    }
+    bench_report_bytes("h_split_string", bytes * repeats, bench_now() - t0);
+    BENCH_KEEP(fields);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r) {
+        h_array_t views = h_split_view(h_string_view(str), ',');
+        fields += views.size;
+        h_array_free(&views);
+    }
+    bench_report_bytes("h_split_view", bytes * repeats, bench_now() - t0);
+    BENCH_KEEP(fields);
+
+    t0 = bench_now();
+    size_t total = 0;
+    for (size_t r=0;r<repeats;++r) {
+        h_split_iter_t split = h_split_iter(h_string_view(str), ',');
+        h_string_view_t field;
+        while (h_split_next(&split, &field)) total += field.size;
+    }
+    bench_report_bytes("h_split_iter", bytes * repeats, bench_now() - t0);
+    BENCH_KEEP(total);
+
+    free(line);
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ *  h_hashmap_t lookups keyed on h_sso_string_t versus strdup'd h_string_t keys,
+ *  plus the cost of building the keys.
+ *
+ *  usage : bench_sso [nkeys] [lookups]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+typedef struct string_pair_t {
+    h_string_t key;
+    u32 value;
+} string_pair_t;
+
+typedef struct sso_pair_t {
+    h_sso_string_t key;
+    u32 value;
+} sso_pair_t;
+
+static u32 string_hash_ptr(void *pair) {
+    h_string_t *str = (h_string_t*)pair;
+    return h_hash_bytes(str->cstr, str->size);
+}
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 1 << 18);
+    size_t lookups = bench_arg(argc, argv, 2, 1 << 22);
+
+    char (*raw)[32] = malloc(n * sizeof(*raw));
+    for (size_t i=0;i<n;++i) snprintf(raw[i], sizeof(raw[i]), "user:%zu:name", i * 2654435761u % 100000000);
+
+    double t0 = bench_now();
+    string_pair_t *string_pairs = malloc(n * sizeof(string_pair_t));
+    for (size_t i=0;i<n;++i) string_pairs[i] = (string_pair_t){h_tostring(strdup(raw[i])), (u32)i};
+    bench_report("build h_string_t keys (strdup)", n, bench_now() - t0);
+
+    t0 = bench_now();
+    sso_pair_t *sso_pairs = malloc(n * sizeof(sso_pair_t));
+    for (size_t i=0;i<n;++i) sso_pairs[i] = (sso_pair_t){h_sso_from_view(h_string_view_cstr(raw[i])), (u32)i};
+    bench_report("build h_sso_string_t keys", n, bench_now() - t0);
+
+    h_hashmap_t string_map = H_CREATE_HASHMAP(string_pair_t, n, string_hash_ptr, h_string_eq_ptr);
+    h_hashmap_t sso_map = H_CREATE_HASHMAP(sso_pair_t, n, h_sso_hash_ptr, h_sso_eq_ptr);
+    for (size_t i=0;i<n;++i) {
+        h_hashmap_put(&string_map, &string_pairs[i]);
+        h_hashmap_put(&sso_map, &sso_pairs[i]);
+    }
+
+    u64 acc = 0;
+    t0 = bench_now();
+    for (size_t i=0;i<lookups;++i) {
+        string_pair_t *pair = h_hashmap_get(&string_map, &string_pairs[(i * 7919) % n].key);
+        acc += pair->value;
+    }
+    bench_report("h_hashmap_get (h_string_t key)", lookups, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t i=0;i<lookups;++i) {
+        sso_pair_t *pair = h_hashmap_get(&sso_map, &sso_pairs[(i * 7919) % n].key);
+        acc += pair->value;
+    }
+    bench_report("h_hashmap_get (h_sso_string_t key)", lookups, bench_now() - t0);
+    BENCH_KEEP(acc);
+
+    h_hashmap_free(&string_map);
+    h_hashmap_free(&sso_map);
+    for (size_t i=0;i<n;++i) {
+        free(string_pairs[i].key.cstr);
+        h_sso_free(&sso_pairs[i].key);
+    }
+    free(string_pairs);
+    free(sso_pairs);
+    free(raw);
+    return 0;
+}
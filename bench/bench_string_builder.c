@@ -0,0 +1,80 @@
+/*
+ *  Log line assembly : a snprintf/strcat loop versus h_string_builder_t backed by the heap,
+ *  an arena and a linear allocator.
+ *
+ *  usage : bench_string_builder [lines]
+ */
+
+#include "bench_common.h"
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+static char const *levels[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+
+static void build_line(h_string_builder_t *sb, size_t i) {
+    h_string_builder_append_cstr(sb, "ts=");
+    h_string_builder_append_u64(sb, 1700000000000ull + i);
+    h_string_builder_append_cstr(sb, " level=");
+    h_string_builder_append_cstr(sb, levels[i & 3]);
+    h_string_builder_append_cstr(sb, " req=");
+    h_string_builder_append_i64(sb, (i64)(i * 2654435761u % 1000000));
+    h_string_builder_append_cstr(sb, " latency_ms=");
+    h_string_builder_append_f64(sb, (f64)(i % 10000) * 0.0137, 3);
+    h_string_builder_append_cstr(sb, " msg=\"request served\"\n");
+}
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 1 << 20);
+    size_t total = 0;
+
+    char line[256];
+    char *out = malloc(n * sizeof(line));
+    double t0 = bench_now();
+    out[0] = 0;
+    char *tail = out;
+    for (size_t i=0;i<n;++i) {
+        snprintf(line, sizeof(line), "ts=%llu level=%s req=%lld latency_ms=%.3f msg=\"request served\"\n",
+            1700000000000ull + i, levels[i & 3], (long long)(i * 2654435761u % 1000000), (double)(i % 10000) * 0.0137);
+        // strcat from the start of the buffer would rescan everything, tail keeps it linear
+        strcat(tail, line);
+        tail += strlen(tail);
+    }
+    bench_report("snprintf + strcat", n, bench_now() - t0);
+    total += strlen(out);
+    free(out);
+
+    t0 = bench_now();
+    h_string_builder_t sb = h_create_string_builder(0);
+    for (size_t i=0;i<n;++i) build_line(&sb, i);
+    h_string_t str = h_string_builder_finish(&sb);
+    bench_report("string builder (heap)", n, bench_now() - t0);
+    total += str.size;
+    free(str.cstr);
+
+    h_arena_t *arena = h_arena_create("bench");
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) {
+        // one short lived builder per line, as a request handler would do
+        h_string_builder_t line_sb = h_create_arena_string_builder(arena, 128);
+        build_line(&line_sb, i);
+        total += h_string_builder_finish(&line_sb).size;
+    }
+    bench_report("string builder (arena, per line)", n, bench_now() - t0);
+    h_arena_destroy(arena);
+
+    h_linear_allocator_t *linear = h_linear_allocator_create(256, "bench");
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) {
+        h_linear_allocator_reset(linear);
+        h_string_builder_t line_sb = h_create_linear_string_builder(linear, 128);
+        build_line(&line_sb, i);
+        total += h_string_builder_finish(&line_sb).size;
+    }
+    bench_report("string builder (linear, per line)", n, bench_now() - t0);
+    h_linear_allocator_destroy(linear);
+
+    BENCH_KEEP(total);
+    return 0;
+}
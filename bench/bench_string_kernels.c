@@ -0,0 +1,107 @@
+/*
+ *  GB/s of the H_STRING search, classification and validation kernels against libc or plain
+ *  byte loops. Build with -mavx2 (or -march=native) to get the SIMD paths.
+ *
+ *  usage : bench_string_kernels [bytes] [repeats]
+ */
+
+#define _GNU_SOURCE
+#include "bench_common.h"
+#include <ctype.h>
+#include <string.h>
+#include <strings.h>
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 64 << 20);
+    size_t repeats = bench_arg(argc, argv, 2, 4);
+    size_t bytes = n * repeats;
+
+    // CSV-like text, mostly ASCII with a sprinkling of 2 and 3 byte sequences
+    h_rng_t rng = h_create_rng(3);
+    char *text = malloc(n + 1);
+    char *copy = malloc(n + 1);
+    for (size_t i=0;i<n;) {
+        u32 r = h_rng_bounded_u32(&rng, 100);
+        if (r < 2 && i + 3 <= n) {
+            memcpy(text + i, "\xe2\x82\xac", 3);
+            i += 3;
+        } else if (r < 4 && i + 2 <= n) {
+            memcpy(text + i, "\xc3\xa9", 2);
+            i += 2;
+        } else if (r < 10) {
+            text[i++] = ' ';
+        } else {
+            text[i++] = (char)((r & 1 ? 'a' : 'A') + r % 26);
+        }
+    }
+    text[n] = 0;
+    memcpy(copy, text, n + 1);
+    h_string_view_t view = {text, n};
+    h_string_view_t needle = h_string_view_cstr("qwertyzz");
+    size_t acc = 0;
+    double t0;
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r,BENCH_CLOBBER()) acc += memmem(text, n, needle.data, needle.size) != NULL;
+    bench_report_bytes("memmem (miss)", bytes, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r,BENCH_CLOBBER()) acc += h_string_find(view, needle);
+    bench_report_bytes("h_string_find (miss)", bytes, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r,BENCH_CLOBBER()) acc += strcspn(text, "\",\n");
+    bench_report_bytes("strcspn", bytes, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r,BENCH_CLOBBER()) acc += h_string_find_any(view, h_string_view_cstr("\",\n"));
+    bench_report_bytes("h_string_find_any", bytes, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r)
+        for (size_t i=0;i<n;++i) acc += text[i] == ' ';
+    bench_report_bytes("count loop", bytes, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r,BENCH_CLOBBER()) acc += h_string_count_char(view, ' ');
+    bench_report_bytes("h_string_count_char", bytes, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r)
+        for (size_t i=0;i<n;++i) copy[i] = (char)tolower((unsigned char)copy[i]);
+    bench_report_bytes("tolower loop", bytes, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r) h_string_to_upper((h_string_t){copy, n});
+    bench_report_bytes("h_string_to_upper", bytes, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r,BENCH_CLOBBER()) acc += (size_t)strncasecmp(text, copy, n);
+    bench_report_bytes("strncasecmp (equal)", bytes, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r,BENCH_CLOBBER()) acc += (size_t)h_string_casecmp(view, (h_string_view_t){copy, n});
+    bench_report_bytes("h_string_casecmp (equal)", bytes, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r) {
+        // naive decoder loop as a baseline : classify each lead byte and skip its continuations
+        size_t i = 0;
+        bool ok = true;
+        while (i < n && ok) {
+            unsigned char c = (unsigned char)text[i];
+            size_t len = c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+            for (size_t k=1;k<len && ok;++k) ok = i + k < n && ((unsigned char)text[i + k] & 0xC0) == 0x80;
+            i += len;
+        }
+        acc += ok;
+    }
+    bench_report_bytes("utf8 byte loop", bytes, bench_now() - t0);
+    t0 = bench_now();
+    for (size_t r=0;r<repeats;++r,BENCH_CLOBBER()) acc += h_utf8_validate(view);
+    bench_report_bytes("h_utf8_validate", bytes, bench_now() - t0);
+
+    BENCH_KEEP(acc);
+    free(text);
+    free(copy);
+    return 0;
+}
@@ -0,0 +1,849 @@
+/*
+ *  Whole library benchmark suite : one or more cases per module (allocators, array, queue, hashmap,
+ *  hash, random, string, bitset, iter, plus the newer collections and sketches), each run through
+ *  bench_harness.h with warmup, repeated rounds and median/p99 reporting. Baseline cases (malloc,
+ *  qsort, strtok, strstr, snprintf, rand, plain C loops) run first in their module and the
+ *  library cases report their speedup against them. The per feature bench_* programs go deeper
+ *  on single topics, H_IO is left to bench_file_reader and bench_snapshot since it needs files.
+ *
+ *  h_enqueue walks the list to its tail and h_hashmap_remove rescans every bucket, so the queue
+ *  case keeps a short queue and the remove case is capped at 256 removals.
+ *
+ *  With -k the suite checks instead of timing : random put/remove/get churn on a hashmap against a
+ *  shadow table, arena allocations spanning many blocks, and bitset set/clear/flip growth and
+ *  iteration against a shadow array. It exits non-zero on the first mismatch, make check runs it
+ *  under ASan and UBSan.
+ *
+ *  usage : bench_suite [-n size] [-w warmup] [-r runs] [-c] [-k] [-f filter] [-o results.json]
+ *          -c  read hardware counters through perf_event_open (Linux)
+ *          -k  run the self checks only
+ *          -f  only run cases whose "module/name" contains filter
+ *          -o  write JSON results to a file, "-" for stdout (the text report then goes to stderr)
+ */
+
+#include "bench_harness.h"
+#include <getopt.h>
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+#define QUEUE_DEPTH 16
+#define REMOVE_CAP 256
+#define ALLOC_SIZE(i) (16 + ((i) * 7) % 49)
+
+typedef struct pair_t {
+    u32 key;
+    u32 value;
+} pair_t;
+
+typedef struct pair64_t {
+    u64 key;
+    u64 value;
+} pair64_t;
+
+static u32 pair_hash(void *pair) { return h_pcg_hash(*(u32*)pair); }
+static bool pair_eq(void *key, void *pair) { return *(u32*)key == *(u32*)pair; }
+
+static int cmp_u64(void const *a, void const *b) {
+    u64 x = *(u64 const*)a, y = *(u64 const*)b;
+    return (x > y) - (x < y);
+}
+
+// n distinct keys in random order
+static u32 *distinct_keys(size_t n, u64 seed) {
+    h_rng_t rng = h_create_rng(seed);
+    u32 *keys = malloc(n * sizeof(u32));
+    for (size_t i=0;i<n;++i) keys[i] = (u32)i * 2654435761u;
+    for (size_t i=n;i>1;--i) {
+        u32 j = h_rng_bounded_u32(&rng, (u32)i), t = keys[i - 1];
+        keys[i - 1] = keys[j];
+        keys[j] = t;
+    }
+    return keys;
+}
+
+// n comma separated fields of 1 to 12 characters
+static char *csv_line(size_t n, size_t *size) {
+    h_rng_t rng = h_create_rng(7);
+    char *line = malloc(n * 13 + 1);
+    size_t pos = 0;
+    for (size_t i=0;i<n;++i) {
+        u32 len = 1 + h_rng_bounded_u32(&rng, 12);
+        for (u32 c=0;c<len;++c) line[pos++] = (char)('a' + h_rng_bounded_u32(&rng, 26));
+        if (i + 1 < n) line[pos++] = ',';
+    }
+    line[pos] = 0;
+    *size = pos;
+    return line;
+}
+
+//
+// Self checks
+//
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            fprintf(stderr, "check failed : " __VA_ARGS__); \
+            fprintf(stderr, "\n"); \
+            return false; \
+        } \
+    } while (0)
+
+// few buckets so chains are long, and keys come back after their removal
+static bool check_hashmap_churn(size_t n) {
+    enum { NKEYS = 512 };
+    u32 shadow[NKEYS];
+    bool present[NKEYS] = {0};
+    size_t count = 0;
+    h_rng_t rng = h_create_rng(11);
+    h_hashmap_t map = H_CREATE_HASHMAP(pair_t, 61, pair_hash, pair_eq);
+
+    for (size_t i=0;i<n;++i) {
+        u32 key = h_rng_bounded_u32(&rng, NKEYS);
+        u32 op = h_rng_bounded_u32(&rng, 3);
+        pair_t *pair = h_hashmap_get(&map, &key);
+        CHECK(!pair == !present[key], "step %zu : key %u is %s the map only", i, key, pair ? "in" : "missing from");
+        CHECK(!pair || pair->value == shadow[key], "step %zu : key %u holds %u, expected %u", i, key, pair->value, shadow[key]);
+        if (op == 0 && !present[key]) {
+            shadow[key] = (u32)i;
+            present[key] = true;
+            count++;
+            h_hashmap_put(&map, &(pair_t){key, (u32)i});
+        }
+        else if (op == 1 && present[key]) {
+            present[key] = false;
+            count--;
+            h_hashmap_remove(&map, &key);
+        }
+        CHECK(map.size == count, "step %zu : map holds %zu pairs, expected %zu", i, (size_t)map.size, count);
+    }
+    for (u32 key=0;key<NKEYS;++key) {
+        pair_t *pair = h_hashmap_get(&map, &key);
+        CHECK(!pair == !present[key] && (!pair || pair->value == shadow[key]), "final : key %u mismatch", key);
+    }
+    h_hashmap_free(&map);
+    return true;
+}
+
+// sizes up to three blocks, every allocation keeps its fill until the arena is destroyed
+static bool check_arena(size_t n) {
+    h_rng_t rng = h_create_rng(12);
+    h_arena_t *arena = h_arena_create("check");
+    unsigned char **ptrs = malloc(n * sizeof(unsigned char*));
+    size_t *sizes = malloc(n * sizeof(size_t));
+    for (size_t i=0;i<n;++i) {
+        sizes[i] = 1 + h_rng_bounded_u32(&rng, i % 64 ? 200 : 3 * H_ARENA_ALLOCATOR_BLOCK_SIZE);
+        ptrs[i] = h_arena_alloc(arena, sizes[i]);
+        CHECK(ptrs[i], "arena allocation %zu of %zu bytes failed", i, sizes[i]);
+        memset(ptrs[i], (int)(i & 0xff), sizes[i]);
+    }
+    for (size_t i=0;i<n;++i)
+        for (size_t j=0;j<sizes[i];++j)
+            CHECK(ptrs[i][j] == (unsigned char)(i & 0xff), "arena allocation %zu overwritten at byte %zu", i, j);
+    h_arena_destroy(arena);
+    free(sizes);
+    free(ptrs);
+    return true;
+}
+
+// random indices grow the bitset past its size, iteration must cover every word exactly once
+static bool check_bitset(size_t n) {
+    size_t nbits = 64 * 64;
+    bool *shadow = calloc(nbits, sizeof(bool));
+    h_rng_t rng = h_create_rng(13);
+    h_bitset_t bitset = h_create_bitset();
+
+    for (size_t i=0;i<n;++i) {
+        size_t idx = h_rng_bounded_u32(&rng, (u32)nbits);
+        switch (h_rng_bounded_u32(&rng, 3)) {
+            case 0: h_bitset_set(&bitset, idx); shadow[idx] = true; break;
+            case 1: h_bitset_clear(&bitset, idx); shadow[idx] = false; break;
+            default: h_bitset_flip(&bitset, idx); shadow[idx] = !shadow[idx]; break;
+        }
+        CHECK(h_bitset_get(&bitset, idx) == shadow[idx], "step %zu : bit %zu differs", i, idx);
+    }
+
+    size_t set = 0, words = 0, bits = 0;
+    for (size_t idx=0;idx<nbits;++idx) {
+        CHECK(h_bitset_get(&bitset, idx) == shadow[idx], "final : bit %zu differs", idx);
+        set += shadow[idx];
+    }
+    h_iter_t it = h_bitset_iter(&bitset);
+    H_FOREACH(u64, word, it) {
+        words++;
+        bits += (size_t)__builtin_popcountll(word);
+    }
+    CHECK(words == bitset.size, "iteration gave %zu words, bitset has %zu", words, (size_t)bitset.size);
+    CHECK(bits == set, "iteration counted %zu set bits, expected %zu", bits, set);
+    h_bitset_free(&bitset);
+    free(shadow);
+    return true;
+}
+
+static int run_checks(size_t n) {
+    struct { char const *name; bool (*fn)(size_t); } checks[] = {
+        {"hashmap put/remove/get churn", check_hashmap_churn},
+        {"arena alloc/destroy", check_arena},
+        {"bitset set/clear/flip/iter", check_bitset},
+    };
+    int failed = 0;
+    for (size_t c=0;c<sizeof(checks)/sizeof(checks[0]);++c) {
+        bool ok = checks[c].fn(n);
+        printf("%-32s %s\n", checks[c].name, ok ? "ok" : "FAILED");
+        failed += !ok;
+    }
+    return failed ? 1 : 0;
+}
+
+//
+// Allocators
+//
+
+static void case_malloc(bench_t *b, size_t n) {
+    void **ptrs = malloc(n * sizeof(void*));
+    bench_start(b);
+    for (size_t i=0;i<n;++i) {
+        ptrs[i] = malloc(ALLOC_SIZE(i));
+        *(char*)ptrs[i] = (char)i;
+    }
+    for (size_t i=0;i<n;++i) free(ptrs[i]);
+    bench_stop(b, n);
+    free(ptrs);
+}
+
+static void case_arena_alloc(bench_t *b, size_t n) {
+    bench_start(b);
+    h_arena_t *arena = h_arena_create("bench");
+    for (size_t i=0;i<n;++i) {
+        char *p = h_arena_alloc(arena, ALLOC_SIZE(i));
+        *p = (char)i;
+        b->sink += (uintptr_t)p;
+    }
+    h_arena_destroy(arena);
+    bench_stop(b, n);
+}
+
+static void case_linear_alloc(bench_t *b, size_t n) {
+    bench_start(b);
+    h_linear_allocator_t *linear = h_linear_allocator_create(n * 64, "bench");
+    for (size_t i=0;i<n;++i) {
+        char *p = h_linear_alloc(linear, ALLOC_SIZE(i));
+        *p = (char)i;
+        b->sink += (uintptr_t)p;
+    }
+    h_linear_allocator_destroy(linear);
+    bench_stop(b, n);
+}
+
+//
+// Arrays
+//
+
+static void case_realloc_push(bench_t *b, size_t n) {
+    bench_start(b);
+    size_t size = 0, cap = 1;
+    u32 *data = malloc(cap * sizeof(u32));
+    for (size_t i=0;i<n;++i) {
+        if (size == cap) data = realloc(data, (cap *= 2) * sizeof(u32));
+        data[size++] = (u32)i;
+    }
+    b->sink += data[n / 2];
+    free(data);
+    bench_stop(b, n);
+}
+
+static void case_array_push(bench_t *b, size_t n) {
+    bench_start(b);
+    h_array_t arr = H_CREATE_ARRAY(u32, 1);
+    for (size_t i=0;i<n;++i) H_ARRAY_PUSH(u32, arr, (u32)i);
+    b->sink += H_ARRAY_GET(u32, arr, n / 2);
+    h_array_free(&arr);
+    bench_stop(b, n);
+}
+
+static void case_array_get(bench_t *b, size_t n) {
+    h_array_t arr = H_CREATE_ARRAY(u32, n);
+    for (size_t i=0;i<n;++i) H_ARRAY_PUSH(u32, arr, (u32)i);
+    bench_start(b);
+    u64 sum = 0;
+    for (size_t i=0;i<n;++i) sum += H_ARRAY_GET(u32, arr, i);
+    bench_stop(b, n);
+    b->sink += sum;
+    h_array_free(&arr);
+}
+
+//
+// Queue
+//
+
+static void case_ring_queue(bench_t *b, size_t n) {
+    u32 ring[QUEUE_DEPTH * 2];
+    size_t head = 0, tail = 0;
+    bench_start(b);
+    for (size_t i=0;i<n;++i) {
+        ring[tail++ % (QUEUE_DEPTH * 2)] = (u32)i;
+        if (tail - head > QUEUE_DEPTH) b->sink += ring[head++ % (QUEUE_DEPTH * 2)];
+    }
+    BENCH_CLOBBER();
+    bench_stop(b, n);
+}
+
+static void case_queue(bench_t *b, size_t n) {
+    h_queue_t queue = H_CREATE_QUEUE(u32);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) {
+        H_ENQUEUE(u32, queue, (u32)i);
+        if (queue.size > QUEUE_DEPTH) b->sink += H_DEQUEUE(u32, queue);
+    }
+    bench_stop(b, n);
+    h_queue_free(&queue);
+}
+
+//
+// Hashmap
+//
+
+static h_hashmap_t filled_map(u32 const *keys, size_t n) {
+    h_hashmap_t map = H_CREATE_HASHMAP(pair_t, 2 * n, pair_hash, pair_eq);
+    for (size_t i=0;i<n;++i) h_hashmap_put(&map, &(pair_t){keys[i], (u32)i});
+    return map;
+}
+
+static void case_hashmap_put(bench_t *b, size_t n) {
+    u32 *keys = distinct_keys(n, 1);
+    bench_start(b);
+    h_hashmap_t map = filled_map(keys, n);
+    bench_stop(b, n);
+    h_hashmap_free(&map);
+    free(keys);
+}
+
+static void case_hashmap_get(bench_t *b, size_t n) {
+    u32 *keys = distinct_keys(n, 1);
+    h_hashmap_t map = filled_map(keys, n);
+    u32 *queries = distinct_keys(n, 2);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) b->sink += ((pair_t*)h_hashmap_get(&map, &queries[i]))->value;
+    bench_stop(b, n);
+    h_hashmap_free(&map);
+    free(queries);
+    free(keys);
+}
+
+static void case_hashmap_get_miss(bench_t *b, size_t n) {
+    u32 *keys = distinct_keys(n, 1);
+    h_hashmap_t map = filled_map(keys, n);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) {
+        u32 miss = keys[i] + 1;     // keys are multiples of an odd constant, never adjacent
+        b->sink += h_hashmap_get(&map, &miss) != NULL;
+    }
+    bench_stop(b, n);
+    h_hashmap_free(&map);
+    free(keys);
+}
+
+static void case_hashmap_remove(bench_t *b, size_t n) {
+    u32 *keys = distinct_keys(n, 1);
+    h_hashmap_t map = filled_map(keys, n);
+    size_t nremove = n < REMOVE_CAP ? n : REMOVE_CAP;
+    bench_start(b);
+    for (size_t i=0;i<nremove;++i) h_hashmap_remove(&map, &keys[i]);
+    bench_stop(b, nremove);
+    b->sink += (u64)map.size;
+    h_hashmap_free(&map);
+    free(keys);
+}
+
+//
+// Hash
+//
+
+static void case_pcg_hash(bench_t *b, size_t n) {
+    bench_start(b);
+    u32 h = 0;
+    for (size_t i=0;i<n;++i) h += h_pcg_hash((u32)i);
+    bench_stop(b, n);
+    b->sink += h;
+}
+
+static void case_hash(bench_t *b, size_t n) {
+    char key[32] = "hclib benchmark key, 32 bytes..";
+    bench_start(b);
+    u32 h = 0;
+    for (size_t i=0;i<n;++i) {
+        key[0] = (char)i;
+        h += h_hash(h_pcg_hash, key, sizeof(key));
+    }
+    bench_stop(b, n);
+    b->sink += h;
+}
+
+static void case_hash_bytes(bench_t *b, size_t n) {
+    char key[32] = "hclib benchmark key, 32 bytes..";
+    bench_start(b);
+    u32 h = 0;
+    for (size_t i=0;i<n;++i) {
+        key[0] = (char)i;
+        h += h_hash_bytes(key, sizeof(key));
+    }
+    bench_stop(b, n);
+    b->sink += h;
+}
+
+static void case_phash_lookup(bench_t *b, size_t n) {
+    u32 *keys = distinct_keys(n, 1);
+    h_phash_t phash = h_create_phash_u32(keys, (u32)n);
+    u32 *queries = distinct_keys(n, 2);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) {
+        u32 idx = h_phash_lookup(&phash, H_PHASH_HASH(queries[i], phash.seed));
+        b->sink += keys[idx] == queries[i];
+    }
+    bench_stop(b, n);
+    h_phash_free(&phash);
+    free(queries);
+    free(keys);
+}
+
+//
+// Random
+//
+
+static void case_rand(bench_t *b, size_t n) {
+    srand(1);
+    bench_start(b);
+    u32 acc = 0;
+    for (size_t i=0;i<n;++i) acc += (u32)rand();
+    bench_stop(b, n);
+    b->sink += acc;
+}
+
+static void case_randf(bench_t *b, size_t n) {
+    bench_start(b);
+    f32 acc = 0;
+    for (size_t i=0;i<n;++i) acc += h_randf((u32)i);
+    bench_stop(b, n);
+    b->sink += (u64)acc;
+}
+
+static void case_rng_next(bench_t *b, size_t n) {
+    h_rng_t rng = h_create_rng(1);
+    bench_start(b);
+    u32 acc = 0;
+    for (size_t i=0;i<n;++i) acc += h_rng_next_u32(&rng);
+    bench_stop(b, n);
+    b->sink += acc;
+}
+
+static void case_rng_fill(bench_t *b, size_t n) {
+    h_rng_t rng = h_create_rng(1);
+    u32 *out = malloc(n * sizeof(u32));
+    bench_start(b);
+    h_rng_fill_u32(&rng, out, n);
+    bench_stop(b, n);
+    b->sink += out[n / 2];
+    free(out);
+}
+
+static void case_rng_normal(bench_t *b, size_t n) {
+    h_rng_t rng = h_create_rng(1);
+    bench_start(b);
+    f64 acc = 0;
+    for (size_t i=0;i<n;++i) acc += h_rng_normal(&rng, 0.0, 1.0);
+    bench_stop(b, n);
+    b->sink += (u64)acc;
+}
+
+//
+// Strings
+//
+
+static void case_strtok(bench_t *b, size_t n) {
+    size_t size;
+    char *line = csv_line(n, &size);
+    bench_start(b);
+    size_t fields = 0;
+    for (char *tok = strtok(line, ","); tok; tok = strtok(NULL, ",")) fields += (size_t)tok[0];
+    bench_stop(b, n);
+    b->sink += fields;
+    free(line);
+}
+
+static void case_split_iter(bench_t *b, size_t n) {
+    size_t size;
+    char *line = csv_line(n, &size);
+    bench_start(b);
+    size_t fields = 0;
+    h_split_iter_t split = h_split_iter((h_string_view_t){line, size}, ',');
+    h_string_view_t field;
+    while (h_split_next(&split, &field)) fields += (size_t)field.data[0];
+    bench_stop(b, n);
+    b->sink += fields;
+    free(line);
+}
+
+static void case_split_string(bench_t *b, size_t n) {
+    size_t size;
+    char *line = csv_line(n, &size);
+    bench_start(b);
+    h_array_t fields = h_split_string((h_string_t){line, size}, ',');
+    bench_stop(b, n);
+    b->sink += fields.size;
+    for (size_t i=0;i<fields.size;++i) free(H_ARRAY_GET(h_string_t, fields, i).cstr);
+    h_array_free(&fields);
+    free(line);
+}
+
+static void case_strstr(bench_t *b, size_t n) {
+    size_t size;
+    char *line = csv_line(n, &size);
+    bench_start(b);
+    for (size_t i=0;i<64;++i) b->sink += (uintptr_t)strstr(line, "qqqqqq");
+    bench_stop(b, 64 * size);
+    free(line);
+}
+
+static void case_string_find(bench_t *b, size_t n) {
+    size_t size;
+    char *line = csv_line(n, &size);
+    bench_start(b);
+    for (size_t i=0;i<64;++i) b->sink += h_string_find((h_string_view_t){line, size}, h_string_view_cstr("qqqqqq"));
+    bench_stop(b, 64 * size);
+    free(line);
+}
+
+static void case_snprintf(bench_t *b, size_t n) {
+    char *buf = malloc(n * 21 + 1);
+    bench_start(b);
+    size_t pos = 0;
+    for (size_t i=0;i<n;++i) pos += (size_t)snprintf(buf + pos, 22, "%llu,", (unsigned long long)i * 2654435761u);
+    bench_stop(b, n);
+    b->sink += pos;
+    free(buf);
+}
+
+static void case_string_builder(bench_t *b, size_t n) {
+    bench_start(b);
+    h_string_builder_t sb = h_create_string_builder(64);
+    for (size_t i=0;i<n;++i) {
+        h_string_builder_append_u64(&sb, (u64)i * 2654435761u);
+        h_string_builder_append_char(&sb, ',');
+    }
+    bench_stop(b, n);
+    b->sink += sb.size;
+    h_string_builder_free(&sb);
+}
+
+static void case_intern(bench_t *b, size_t n) {
+    size_t size;
+    char *line = csv_line(n, &size);
+    bench_start(b);
+    h_interner_t interner = h_create_interner(n);
+    h_split_iter_t split = h_split_iter((h_string_view_t){line, size}, ',');
+    h_string_view_t field;
+    while (h_split_next(&split, &field)) b->sink += h_intern(&interner, field);
+    bench_stop(b, n);
+    h_interner_free(&interner);
+    free(line);
+}
+
+//
+// Bitsets
+//
+
+static void case_u64_bits(bench_t *b, size_t n) {
+    u32 *idx = distinct_keys(n, 3);
+    u64 *words = calloc(n / 64 + 1, sizeof(u64));
+    bench_start(b);
+    for (size_t i=0;i<n;++i) words[(idx[i] % n) / 64] |= 1ull << (idx[i] % n % 64);
+    for (size_t i=0;i<n;++i) b->sink += (words[i / 64] >> (i % 64)) & 1;
+    bench_stop(b, 2 * n);
+    free(words);
+    free(idx);
+}
+
+static void case_bitset(bench_t *b, size_t n) {
+    u32 *idx = distinct_keys(n, 3);
+    h_bitset_t bitset = h_create_bitset();
+    h_bitset_set(&bitset, n);
+    h_bitset_clear(&bitset, n);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) h_bitset_set(&bitset, idx[i] % n);
+    for (size_t i=0;i<n;++i) b->sink += h_bitset_get(&bitset, i);
+    bench_stop(b, 2 * n);
+    h_bitset_free(&bitset);
+    free(idx);
+}
+
+static void case_bitset_or(bench_t *b, size_t n) {
+    h_bitset_t a = h_create_bitset(), c = h_create_bitset();
+    for (size_t i=0;i<n;i+=3) h_bitset_set(&a, i);
+    for (size_t i=0;i<n;i+=5) h_bitset_set(&c, i);
+    bench_start(b);
+    for (size_t r=0;r<64;++r) h_bitset_or(&a, &c);
+    bench_stop(b, 64 * a.size);
+    b->sink += a.words[0];
+    h_bitset_free(&a);
+    h_bitset_free(&c);
+}
+
+static void case_atomic_bitset(bench_t *b, size_t n) {
+    u32 *idx = distinct_keys(n, 3);
+    h_atomic_bitset_t bitset = h_create_atomic_bitset(n);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) b->sink += h_atomic_bitset_test_and_set(&bitset, idx[i] % n);
+    bench_stop(b, n);
+    h_atomic_bitset_free(&bitset);
+    free(idx);
+}
+
+//
+// Iterators
+//
+
+static void case_for_loop(bench_t *b, size_t n) {
+    h_array_t arr = H_CREATE_ARRAY(u32, n);
+    for (size_t i=0;i<n;++i) H_ARRAY_PUSH(u32, arr, (u32)i);
+    bench_start(b);
+    u64 sum = 0;
+    for (size_t i=0;i<arr.size;++i) sum += ((u32*)arr.data)[i];
+    bench_stop(b, n);
+    b->sink += sum;
+    h_array_free(&arr);
+}
+
+static void case_array_iter(bench_t *b, size_t n) {
+    h_array_t arr = H_CREATE_ARRAY(u32, n);
+    for (size_t i=0;i<n;++i) H_ARRAY_PUSH(u32, arr, (u32)i);
+    bench_start(b);
+    u64 sum = 0;
+    h_iter_t it = h_array_iter(&arr);
+    H_FOREACH(u32, v, it) sum += v;
+    bench_stop(b, n);
+    b->sink += sum;
+    h_array_free(&arr);
+}
+
+static void case_bitset_iter(bench_t *b, size_t n) {
+    h_bitset_t bitset = h_create_bitset();
+    for (size_t i=0;i<n;i+=3) h_bitset_set(&bitset, i);
+    bench_start(b);
+    u64 count = 0;
+    h_iter_t it = h_bitset_iter(&bitset);
+    H_FOREACH(u64, word, it) count += (u64)__builtin_popcountll(word);
+    bench_stop(b, bitset.size);
+    b->sink += count;
+    h_bitset_free(&bitset);
+}
+
+static void case_split_view_iter(bench_t *b, size_t n) {
+    size_t size;
+    char *line = csv_line(n, &size);
+    bench_start(b);
+    size_t fields = 0;
+    h_split_iter_t split = h_split_iter((h_string_view_t){line, size}, ',');
+    h_iter_t it = h_split_view_iter(&split);
+    H_FOREACH(h_string_view_t, field, it) fields += field.size;
+    bench_stop(b, n);
+    b->sink += fields;
+    free(line);
+}
+
+//
+// Ordered and handle based collections
+//
+
+static void case_qsort(bench_t *b, size_t n) {
+    h_rng_t rng = h_create_rng(4);
+    u64 *keys = malloc(n * sizeof(u64));
+    for (size_t i=0;i<n;++i) keys[i] = h_rng_next_u64(&rng);
+    bench_start(b);
+    qsort(keys, n, sizeof(u64), cmp_u64);
+    bench_stop(b, n);
+    b->sink += keys[n / 2];
+    free(keys);
+}
+
+// same job as qsort : ordering n random keys, inserting them then walking the leaves
+static void case_btree_sort(bench_t *b, size_t n) {
+    h_rng_t rng = h_create_rng(4);
+    u64 *keys = malloc(n * sizeof(u64));
+    for (size_t i=0;i<n;++i) keys[i] = h_rng_next_u64(&rng);
+    bench_start(b);
+    h_btree_t tree = H_CREATE_BTREE_INT(pair64_t, H_BTREE_KEY_U64);
+    for (size_t i=0;i<n;++i) h_btree_put(&tree, &(pair64_t){keys[i], i});
+    h_btree_cursor_t cursor = h_btree_range(&tree, NULL, NULL);
+    pair64_t *pair;
+    while ((pair = h_btree_next(&cursor))) b->sink += pair->value;
+    bench_stop(b, n);
+    h_btree_free(&tree);
+    free(keys);
+}
+
+static void case_btree_get(bench_t *b, size_t n) {
+    u32 *keys = distinct_keys(n, 1);
+    h_btree_t tree = H_CREATE_BTREE_INT(pair_t, H_BTREE_KEY_U32);
+    for (size_t i=0;i<n;++i) h_btree_put(&tree, &(pair_t){keys[i], (u32)i});
+    u32 *queries = distinct_keys(n, 2);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) b->sink += ((pair_t*)h_btree_get(&tree, &queries[i]))->value;
+    bench_stop(b, n);
+    h_btree_free(&tree);
+    free(queries);
+    free(keys);
+}
+
+static void case_slot_map(bench_t *b, size_t n) {
+    h_slot_map_t map = H_CREATE_SLOT_MAP(u64, 16);
+    h_handle_t *handles = malloc(n * sizeof(h_handle_t));
+    bench_start(b);
+    for (size_t i=0;i<n;++i) handles[i] = H_SLOT_MAP_INSERT(u64, map, (u64)i);
+    for (size_t i=0;i<n;++i) b->sink += *H_SLOT_MAP_GET(u64, map, handles[(i * 7) % n]);
+    bench_stop(b, 2 * n);
+    h_slot_map_free(&map);
+    free(handles);
+}
+
+static void case_sparse_set(bench_t *b, size_t n) {
+    u32 *ids = distinct_keys(n, 5);
+    h_sparse_set_t set = h_create_sparse_set(0, (u32)n);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) h_sparse_set_insert(&set, ids[i] % (u32)n, NULL);
+    for (size_t i=0;i<n;++i) b->sink += h_sparse_set_contains(&set, (u32)i);
+    bench_stop(b, 2 * n);
+    h_sparse_set_free(&set);
+    free(ids);
+}
+
+//
+// Sketches
+//
+
+static void case_bloom(bench_t *b, size_t n) {
+    u32 *keys = distinct_keys(n, 1);
+    h_bloom_t bloom = h_create_bloom(n, 0.01);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) h_bloom_insert(&bloom, &keys[i], sizeof(u32));
+    for (size_t i=0;i<n;++i) {
+        u32 miss = keys[i] + 1;
+        b->sink += h_bloom_query(&bloom, &miss, sizeof(u32));
+    }
+    bench_stop(b, 2 * n);
+    h_bloom_free(&bloom);
+    free(keys);
+}
+
+static void case_count_min(bench_t *b, size_t n) {
+    u32 *keys = distinct_keys(n, 1);
+    h_count_min_t sketch = h_create_count_min(0.001, 0.01);
+    bench_start(b);
+    for (size_t i=0;i<n;++i) h_count_min_add_hash(&sketch, h_pcg_hash(keys[i] % 1024), 1);
+    for (size_t i=0;i<n;++i) b->sink += h_count_min_estimate_hash(&sketch, h_pcg_hash(keys[i] % 1024));
+    bench_stop(b, 2 * n);
+    h_count_min_free(&sketch);
+    free(keys);
+}
+
+int main(int argc, char **argv) {
+    static bench_t b;
+    b = (bench_t){.size = 1 << 16, .warmup = 2, .runs = 15, .log = stdout};
+    bool counters = false, check = false;
+    char const *json_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:w:r:ckf:o:")) != -1) {
+        switch (opt) {
+            case 'n': b.size = (size_t)strtoull(optarg, NULL, 10); break;
+            case 'w': b.warmup = (size_t)strtoull(optarg, NULL, 10); break;
+            case 'r': b.runs = (size_t)strtoull(optarg, NULL, 10); break;
+            case 'c': counters = true; break;
+            case 'k': check = true; break;
+            case 'f': b.filter = optarg; break;
+            case 'o': json_path = optarg; break;
+            default:
+                fprintf(stderr, "usage : bench_suite [-n size] [-w warmup] [-r runs] [-c] [-k] [-f filter] [-o results.json]\n");
+                return 1;
+        }
+    }
+    if (b.size < 2) b.size = 2;
+    if (b.runs < 1) b.runs = 1;
+    if (check) return run_checks(b.size);
+    FILE *json = NULL;
+    if (json_path && !strcmp(json_path, "-")) {
+        json = stdout;
+        b.log = stderr;
+    }
+    else if (json_path && !(json = fopen(json_path, "w"))) {
+        fprintf(stderr, "bench_suite : can't write %s\n", json_path);
+        return 1;
+    }
+
+    for (int c=0;c<BENCH_NCOUNTERS;++c) b.fds[c] = -1;
+    if (counters && !bench_counters_open(&b)) fprintf(b.log, "perf_event_open unavailable, timing only\n");
+    fprintf(b.log, "size %zu, %zu warmup + %zu timed runs per case\n", b.size, b.warmup, b.runs);
+
+    bench_case(&b, "allocators", "malloc", NULL, case_malloc);
+    bench_case(&b, "allocators", "h_arena_alloc", "malloc", case_arena_alloc);
+    bench_case(&b, "allocators", "h_linear_alloc", "malloc", case_linear_alloc);
+
+    bench_case(&b, "array", "realloc push", NULL, case_realloc_push);
+    bench_case(&b, "array", "h_array_push", "realloc push", case_array_push);
+    bench_case(&b, "array", "h_array_get", NULL, case_array_get);
+
+    bench_case(&b, "queue", "ring buffer", NULL, case_ring_queue);
+    bench_case(&b, "queue", "h_enqueue+h_dequeue", "ring buffer", case_queue);
+
+    bench_case(&b, "hashmap", "h_hashmap_put", NULL, case_hashmap_put);
+    bench_case(&b, "hashmap", "h_hashmap_get", NULL, case_hashmap_get);
+    bench_case(&b, "hashmap", "h_hashmap_get miss", NULL, case_hashmap_get_miss);
+    bench_case(&b, "hashmap", "h_hashmap_remove", NULL, case_hashmap_remove);
+
+    bench_case(&b, "hash", "h_pcg_hash", NULL, case_pcg_hash);
+    bench_case(&b, "hash", "h_hash 32B", NULL, case_hash);
+    bench_case(&b, "hash", "h_hash_bytes 32B", "h_hash 32B", case_hash_bytes);
+    bench_case(&b, "hash", "h_phash_lookup", "h_hashmap_get", case_phash_lookup);
+
+    bench_case(&b, "random", "rand", NULL, case_rand);
+    bench_case(&b, "random", "h_randf", "rand", case_randf);
+    bench_case(&b, "random", "h_rng_next_u32", "rand", case_rng_next);
+    bench_case(&b, "random", "h_rng_fill_u32", "rand", case_rng_fill);
+    bench_case(&b, "random", "h_rng_normal", NULL, case_rng_normal);
+
+    bench_case(&b, "string", "strtok", NULL, case_strtok);
+    bench_case(&b, "string", "h_split_next", "strtok", case_split_iter);
+    bench_case(&b, "string", "h_split_string", "strtok", case_split_string);
+    bench_case(&b, "string", "strstr", NULL, case_strstr);
+    bench_case(&b, "string", "h_string_find", "strstr", case_string_find);
+    bench_case(&b, "string", "snprintf", NULL, case_snprintf);
+    bench_case(&b, "string", "h_string_builder_append_u64", "snprintf", case_string_builder);
+    bench_case(&b, "string", "h_intern", NULL, case_intern);
+
+    bench_case(&b, "bitset", "u64 words", NULL, case_u64_bits);
+    bench_case(&b, "bitset", "h_bitset_set+get", "u64 words", case_bitset);
+    bench_case(&b, "bitset", "h_bitset_or", NULL, case_bitset_or);
+    bench_case(&b, "bitset", "h_atomic_bitset_test_and_set", NULL, case_atomic_bitset);
+
+    bench_case(&b, "iter", "for loop", NULL, case_for_loop);
+    bench_case(&b, "iter", "h_array_iter", "for loop", case_array_iter);
+    bench_case(&b, "iter", "h_bitset_iter", NULL, case_bitset_iter);
+    bench_case(&b, "iter", "h_split_view_iter", "h_split_next", case_split_view_iter);
+
+    bench_case(&b, "collections", "qsort", NULL, case_qsort);
+    bench_case(&b, "collections", "h_btree_put+scan", "qsort", case_btree_sort);
+    bench_case(&b, "collections", "h_btree_get", "h_hashmap_get", case_btree_get);
+    bench_case(&b, "collections", "h_slot_map insert+get", NULL, case_slot_map);
+    bench_case(&b, "collections", "h_sparse_set insert+contains", NULL, case_sparse_set);
+
+    bench_case(&b, "sketch", "h_bloom insert+query", NULL, case_bloom);
+    bench_case(&b, "sketch", "h_count_min add+estimate", NULL, case_count_min);
+
+    if (json) {
+        bench_write_json(&b, json);
+        if (json != stdout) fclose(json);
+    }
+    bench_counters_close(&b);
+    BENCH_KEEP(b.sink);
+    return 0;
+}
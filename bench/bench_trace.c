@@ -0,0 +1,76 @@
+/*
+ *  Tracing overhead : the cost of an empty zone and of a counter, and h_hashmap_get with its
+ *  built-in zone. The Makefile also builds bench_trace_off (BENCH_NO_TRACE) from this file,
+ *  where the same loops run with the zones compiled out. Then the time to drain the rings to
+ *  Chrome trace JSON.
+ *
+ *  usage : bench_trace [count] [trace_path]
+ */
+
+#include "bench_common.h"
+
+#ifndef BENCH_NO_TRACE
+#define H_TRACE
+#endif
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+typedef struct pair_t {
+    u32 key;
+    u32 value;
+} pair_t;
+
+static u32 pair_hash(void *pair) { return h_pcg_hash(*(u32*)pair); }
+static bool pair_eq(void *key, void *pair) { return *(u32*)key == *(u32*)pair; }
+
+int main(int argc, char **argv) {
+    size_t n = bench_arg(argc, argv, 1, 1 << 22);
+    char const *path = argc > 2 ? argv[2] : "/tmp/hclib_trace.json";
+#ifdef H_TRACE
+    printf("tracing on, %d events per thread ring\n", H_TRACE_BUFFER_EVENTS);
+#else
+    printf("tracing compiled out\n");
+#endif
+
+    u64 acc = 0;
+    double t0 = bench_now();
+    for (size_t i=0;i<n;++i) {
+        H_TRACE_ZONE("empty");
+        acc += i;
+        BENCH_CLOBBER();
+    }
+    bench_report("empty zone", n, bench_now() - t0);
+
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) {
+        H_TRACE_COUNTER("counter", i);
+        BENCH_CLOBBER();
+    }
+    bench_report("counter", n, bench_now() - t0);
+
+    size_t npairs = 1 << 16;
+    h_hashmap_t map = H_CREATE_HASHMAP(pair_t, 2 * npairs, pair_hash, pair_eq);
+    for (u32 i=0;i<npairs;++i) h_hashmap_put(&map, &(pair_t){i * 2654435761u, i});
+    t0 = bench_now();
+    for (size_t i=0;i<n;++i) {
+        u32 key = (u32)(i % npairs) * 2654435761u;
+        acc += ((pair_t*)h_hashmap_get(&map, &key))->value;
+    }
+    bench_report("h_hashmap_get", n, bench_now() - t0);
+    h_hashmap_free(&map);
+
+#ifdef H_TRACE
+    t0 = bench_now();
+    FILE *out = fopen(path, "w");
+    size_t events = out ? h_trace_write(out) : 0;
+    if (out) fclose(out);
+    bench_report("h_trace_write (incl. 10 ms calibration)", events ? events : 1, bench_now() - t0);
+    printf("trace written to %s\n", path);
+#else
+    (void)path;
+#endif
+
+    BENCH_KEEP(acc);
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ *  Generated by phash_gen from 70 string keys, do not edit.
+ *  Needs hclib.h with H_HASH declared, and h_phash_hash_bytes defined (H_DEFINITIONS).
+ */
+
+#ifndef HTTP_HEADERS_PHASH_H
+#define HTTP_HEADERS_PHASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define HTTP_HEADERS_SEED 0xa8beea3cu
+#define HTTP_HEADERS_BUCKET_BITS 5
+#define HTTP_HEADERS_SLOT_BITS 7
+#define HTTP_HEADERS_COUNT 70
+
+typedef struct http_headers_entry_t {
+    char const *key;
+    uint32_t size;
+    int value;
+} http_headers_entry_t;
+
+static const uint16_t http_headers_disp[32] = {
+    0, 1, 0, 0, 0, 1, 3, 2, 0, 1, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 1,
+};
+
+static const http_headers_entry_t http_headers_table[128] = {
+    {"X-Forwarded-Host", 16, 66},
+    {"Date", 4, 28},
+    {0, 0, 0},
+    {"User-Agent", 10, 60},
+    {"X-Content-Type-Options", 22, 64},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"X-Request-ID", 12, 69},
+    {0, 0, 0},
+    {"Accept", 6, 0},
+    {"WWW-Authenticate", 16, 63},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Accept-Ranges", 13, 4},
+    {"Upgrade", 7, 59},
+    {0, 0, 0},
+    {"Connection", 10, 18},
+    {"Referrer-Policy", 15, 51},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Last-Modified", 13, 41},
+    {0, 0, 0},
+    {"Accept-Charset", 14, 1},
+    {0, 0, 0},
+    {"Location", 8, 43},
+    {"Alt-Svc", 7, 15},
+    {0, 0, 0},
+    {"If-None-Match", 13, 37},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"TE", 2, 56},
+    {"Content-Type", 12, 26},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Max-Forwards", 12, 44},
+    {"Origin", 6, 45},
+    {"Set-Cookie", 10, 54},
+    {0, 0, 0},
+    {"Keep-Alive", 10, 40},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Authorization", 13, 16},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Content-Length", 14, 22},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Server", 6, 53},
+    {0, 0, 0},
+    {"Cache-Control", 13, 17},
+    {0, 0, 0},
+    {"Access-Control-Allow-Methods", 28, 7},
+    {0, 0, 0},
+    {"Vary", 4, 61},
+    {"Access-Control-Allow-Credentials", 32, 5},
+    {"From", 4, 33},
+    {"If-Match", 8, 35},
+    {"Content-Disposition", 19, 19},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"X-Forwarded-For", 15, 65},
+    {"X-Frame-Options", 15, 68},
+    {"Cookie", 6, 27},
+    {"If-Modified-Since", 17, 36},
+    {0, 0, 0},
+    {"Accept-Encoding", 15, 2},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Link", 4, 42},
+    {"If-Range", 8, 38},
+    {0, 0, 0},
+    {"Forwarded", 9, 32},
+    {0, 0, 0},
+    {"Allow", 5, 14},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Via", 3, 62},
+    {0, 0, 0},
+    {"Proxy-Authorization", 19, 48},
+    {"Accept-Language", 15, 3},
+    {"Content-Range", 13, 24},
+    {"Access-Control-Expose-Headers", 29, 9},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"ETag", 4, 29},
+    {"Access-Control-Request-Method", 29, 12},
+    {"Access-Control-Request-Headers", 30, 11},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"X-Forwarded-Proto", 17, 67},
+    {"Content-Location", 16, 23},
+    {"Transfer-Encoding", 17, 58},
+    {"Content-Encoding", 16, 20},
+    {"Age", 3, 13},
+    {"If-Unmodified-Since", 19, 39},
+    {"Content-Language", 16, 21},
+    {"Strict-Transport-Security", 25, 55},
+    {"Retry-After", 11, 52},
+    {"Referer", 7, 50},
+    {"Proxy-Authenticate", 18, 47},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Access-Control-Allow-Headers", 28, 6},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Range", 5, 49},
+    {0, 0, 0},
+    {0, 0, 0},
+    {"Access-Control-Allow-Origin", 27, 8},
+    {0, 0, 0},
+    {"Trailer", 7, 57},
+    {"Access-Control-Max-Age", 22, 10},
+    {"Expect", 6, 30},
+    {"Pragma", 6, 46},
+    {0, 0, 0},
+    {"Host", 4, 34},
+    {"Expires", 7, 31},
+    {"Content-Security-Policy", 23, 25},
+    {0, 0, 0},
+};
+
+static inline http_headers_entry_t const *http_headers_find(char const *key, size_t size) {
+    uint64_t hash = h_phash_hash_bytes(key, size, HTTP_HEADERS_SEED);
+    http_headers_entry_t const *entry = &http_headers_table[H_PHASH_SLOT(hash, http_headers_disp[H_PHASH_BUCKET(hash, HTTP_HEADERS_BUCKET_BITS)], HTTP_HEADERS_SLOT_BITS)];
+    return entry->key && entry->size == size && memcmp(entry->key, key, size) == 0 ? entry : (http_headers_entry_t const*)0;
+}
+
+#endif
@@ -0,0 +1,497 @@
+/*
+ *  Generated by phash_gen from 200 integer keys, do not edit.
+ *  Needs hclib.h with H_HASH declared.
+ */
+
+#ifndef OPCODES_PHASH_H
+#define OPCODES_PHASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define OPCODES_SEED 0xa8beea3cu
+#define OPCODES_BUCKET_BITS 6
+#define OPCODES_SLOT_BITS 8
+#define OPCODES_COUNT 200
+
+typedef struct opcodes_entry_t {
+    uint32_t key;
+    uint32_t used;
+    uint32_t value;
+} opcodes_entry_t;
+
+static const uint16_t opcodes_disp[64] = {
+    12, 2, 23, 7, 3, 0, 0, 0, 1, 1, 1, 0, 2, 4, 2, 1,
+    2, 1, 4, 0, 21, 0, 18, 4, 3, 4, 8, 1, 0, 4, 4, 0,
+    0, 12, 1, 3, 1, 14, 2, 3, 6, 1, 2, 0, 4, 22, 7, 14,
+    0, 0, 2, 3, 19, 20, 8, 3, 0, 4, 6, 6, 7, 2, 3, 2,
+};
+
+static const opcodes_entry_t opcodes_table[256] = {
+    {0x000923a8u, 1, 376u},
+    {0x000b3950u, 1, 466u},
+    {0x0001818fu, 1, 76u},
+    {0, 0, 0},
+    {0x000bb2d5u, 1, 481u},
+    {0x0000f17bu, 1, 22u},
+    {0x0006cad5u, 1, 274u},
+    {0x000930d7u, 1, 382u},
+    {0x0005bd87u, 1, 226u},
+    {0x0005d9ddu, 1, 232u},
+    {0, 0, 0},
+    {0x0007f1b2u, 1, 322u},
+    {0x000bd057u, 1, 484u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x00057910u, 1, 211u},
+    {0x00037dc8u, 1, 142u},
+    {0x0001e27bu, 1, 88u},
+    {0x00058d56u, 1, 217u},
+    {0x00009996u, 1, 4u},
+    {0x0007d2cbu, 1, 310u},
+    {0x000e25a8u, 1, 550u},
+    {0x000d7083u, 1, 529u},
+    {0x000892fau, 1, 340u},
+    {0x0006b0d6u, 1, 265u},
+    {0x000b2f15u, 1, 463u},
+    {0x000d269bu, 1, 523u},
+    {0x0008ede1u, 1, 361u},
+    {0x00074c9eu, 1, 298u},
+    {0x000d3acau, 1, 526u},
+    {0, 0, 0},
+    {0x0008cdb4u, 1, 352u},
+    {0x000ae659u, 1, 448u},
+    {0x0000f21eu, 1, 25u},
+    {0x0001e399u, 1, 91u},
+    {0x0007631bu, 1, 301u},
+    {0x00072159u, 1, 286u},
+    {0x0000f881u, 1, 31u},
+    {0x000451acu, 1, 166u},
+    {0x00039264u, 1, 148u},
+    {0x0003e7d2u, 1, 157u},
+    {0x0000ed91u, 1, 19u},
+    {0, 0, 0},
+    {0x000dbc4au, 1, 532u},
+    {0x000b774fu, 1, 475u},
+    {0x0008d117u, 1, 355u},
+    {0x0000cb1fu, 1, 16u},
+    {0, 0, 0},
+    {0x0000fd64u, 1, 34u},
+    {0x000d17fau, 1, 514u},
+    {0x00024edfu, 1, 106u},
+    {0x00066d23u, 1, 256u},
+    {0, 0, 0},
+    {0x0006164au, 1, 238u},
+    {0x00095e77u, 1, 406u},
+    {0, 0, 0},
+    {0x000fe3b9u, 1, 598u},
+    {0x00094741u, 1, 391u},
+    {0x00093bd1u, 1, 385u},
+    {0x00017f5fu, 1, 73u},
+    {0x0005051du, 1, 199u},
+    {0, 0, 0},
+    {0x000230dau, 1, 103u},
+    {0x00072fe0u, 1, 292u},
+    {0x000269e1u, 1, 109u},
+    {0, 0, 0},
+    {0x000c7a2fu, 1, 499u},
+    {0x0002e442u, 1, 130u},
+    {0, 0, 0},
+    {0x0006b0a2u, 1, 262u},
+    {0x0006b4ccu, 1, 268u},
+    {0, 0, 0},
+    {0x0003f98fu, 1, 163u},
+    {0x000f2a75u, 1, 580u},
+    {0x00094e3cu, 1, 394u},
+    {0x0004cbd9u, 1, 187u},
+    {0x00092277u, 1, 373u},
+    {0x000ca022u, 1, 502u},
+    {0x0008f6d1u, 1, 364u},
+    {0x000a38feu, 1, 427u},
+    {0x0004f427u, 1, 196u},
+    {0x0009c654u, 1, 415u},
+    {0x000ab2ceu, 1, 442u},
+    {0x000e2258u, 1, 547u},
+    {0x0004a23eu, 1, 184u},
+    {0x00010a3eu, 1, 40u},
+    {0x00005c6bu, 1, 1u},
+    {0x0000beceu, 1, 10u},
+    {0x000658ceu, 1, 250u},
+    {0, 0, 0},
+    {0x0001fb18u, 1, 94u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x0007f151u, 1, 319u},
+    {0x000ab104u, 1, 439u},
+    {0x000830e1u, 1, 331u},
+    {0x000e01f6u, 1, 544u},
+    {0, 0, 0},
+    {0x000f646fu, 1, 586u},
+    {0x000babcfu, 1, 478u},
+    {0x00093f45u, 1, 388u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x00059a55u, 1, 220u},
+    {0, 0, 0},
+    {0x00052e6cu, 1, 205u},
+    {0x000c6f88u, 1, 496u},
+    {0x00057ee1u, 1, 214u},
+    {0x000b4d67u, 1, 469u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x0002e054u, 1, 127u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x00018f14u, 1, 79u},
+    {0x0003b129u, 1, 151u},
+    {0x00092b1eu, 1, 379u},
+    {0x0006f037u, 1, 283u},
+    {0, 0, 0},
+    {0x000cb5c8u, 1, 505u},
+    {0, 0, 0},
+    {0x0006bf47u, 1, 271u},
+    {0x000eeeadu, 1, 565u},
+    {0, 0, 0},
+    {0x000795e9u, 1, 307u},
+    {0x000f0ce6u, 1, 568u},
+    {0x000b2716u, 1, 460u},
+    {0, 0, 0},
+    {0x0006e36bu, 1, 280u},
+    {0x0000a098u, 1, 7u},
+    {0, 0, 0},
+    {0x000506c0u, 1, 202u},
+    {0x000119a8u, 1, 43u},
+    {0x000faeccu, 1, 592u},
+    {0x000ae97cu, 1, 451u},
+    {0x00012bd5u, 1, 52u},
+    {0x0008ca82u, 1, 349u},
+    {0x0007731bu, 1, 304u},
+    {0x0002a3b0u, 1, 118u},
+    {0x0000c5c8u, 1, 13u},
+    {0x000eab48u, 1, 559u},
+    {0x000c3bafu, 1, 490u},
+    {0, 0, 0},
+    {0x000211c8u, 1, 97u},
+    {0, 0, 0},
+    {0x0001dfa0u, 1, 85u},
+    {0x000ec66bu, 1, 562u},
+    {0x000aec70u, 1, 454u},
+    {0x00030186u, 1, 133u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x000a5aa4u, 1, 430u},
+    {0x0007403fu, 1, 295u},
+    {0x00095e61u, 1, 403u},
+    {0, 0, 0},
+    {0x000a09f8u, 1, 421u},
+    {0x00014a10u, 1, 58u},
+    {0, 0, 0},
+    {0x000a6a3bu, 1, 433u},
+    {0x000e3152u, 1, 553u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x00034b9cu, 1, 136u},
+    {0, 0, 0},
+    {0x0004cdd3u, 1, 190u},
+    {0, 0, 0},
+    {0x00011e21u, 1, 46u},
+    {0x000c4aafu, 1, 493u},
+    {0x0003898eu, 1, 145u},
+    {0x000b64cfu, 1, 472u},
+    {0x00036f68u, 1, 139u},
+    {0x000953f5u, 1, 400u},
+    {0, 0, 0},
+    {0x00048db5u, 1, 175u},
+    {0, 0, 0},
+    {0x00062c34u, 1, 241u},
+    {0x000f52deu, 1, 583u},
+    {0, 0, 0},
+    {0x000aa05fu, 1, 436u},
+    {0x00064155u, 1, 244u},
+    {0x00090c1au, 1, 370u},
+    {0x00057125u, 1, 208u},
+    {0x000df159u, 1, 538u},
+    {0x0006a50eu, 1, 259u},
+    {0x000a170cu, 1, 424u},
+    {0x0005c90bu, 1, 229u},
+    {0x0006d76cu, 1, 277u},
+    {0x000128b3u, 1, 49u},
+    {0x00026e88u, 1, 115u},
+    {0, 0, 0},
+    {0x000f29d1u, 1, 577u},
+    {0x0007f262u, 1, 325u},
+    {0x0001600bu, 1, 67u},
+    {0, 0, 0},
+    {0x000d23f1u, 1, 520u},
+    {0x0008e81au, 1, 358u},
+    {0x0009531au, 1, 397u},
+    {0x00047208u, 1, 169u},
+    {0x000881eeu, 1, 337u},
+    {0x000cc012u, 1, 508u},
+    {0x0009828au, 1, 409u},
+    {0x0003f63bu, 1, 160u},
+    {0x000d1bc6u, 1, 517u},
+    {0x0009e777u, 1, 418u},
+    {0x000f1d6au, 1, 571u},
+    {0x000ae2ecu, 1, 445u},
+    {0x00065133u, 1, 247u},
+    {0, 0, 0},
+    {0x000f9ebeu, 1, 589u},
+    {0x000b1fefu, 1, 457u},
+    {0x000fc892u, 1, 595u},
+    {0x000d0edbu, 1, 511u},
+    {0x0000f421u, 1, 28u},
+    {0x0004746au, 1, 172u},
+    {0x0005affcu, 1, 223u},
+    {0x00010130u, 1, 37u},
+    {0x000e8e26u, 1, 556u},
+    {0x00086735u, 1, 334u},
+    {0, 0, 0},
+    {0x0002217cu, 1, 100u},
+    {0x00072e6du, 1, 289u},
+    {0x00065dcau, 1, 253u},
+    {0x00081e75u, 1, 328u},
+    {0x0001a61eu, 1, 82u},
+    {0x0007ec00u, 1, 316u},
+    {0x00049953u, 1, 178u},
+    {0x000f28c2u, 1, 574u},
+    {0x000c1d40u, 1, 487u},
+    {0x0002b054u, 1, 124u},
+    {0x00049b65u, 1, 181u},
+    {0x00026a2du, 1, 112u},
+    {0x0005f558u, 1, 235u},
+    {0x000153e8u, 1, 64u},
+    {0x000907a8u, 1, 367u},
+    {0x000e0091u, 1, 541u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x0007e62bu, 1, 313u},
+    {0x0008a6a7u, 1, 343u},
+    {0x0003d9c2u, 1, 154u},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0x0009be4cu, 1, 412u},
+    {0x00017390u, 1, 70u},
+    {0, 0, 0},
+    {0x00014f48u, 1, 61u},
+    {0x0002a970u, 1, 121u},
+    {0x0008c390u, 1, 346u},
+    {0x0004ef8bu, 1, 193u},
+    {0x00013defu, 1, 55u},
+    {0, 0, 0},
+    {0x000dd2e2u, 1, 535u},
+};
+
+// the compiler places every key again through the hclib macros
+typedef char opcodes_phash_check_0[H_PHASH_BUCKET(H_PHASH_HASH(0x000923a8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 40 && H_PHASH_SLOT(H_PHASH_HASH(0x000923a8u, OPCODES_SEED), 6, OPCODES_SLOT_BITS) == 0 ? 1 : -1];
+typedef char opcodes_phash_check_1[H_PHASH_BUCKET(H_PHASH_HASH(0x000b3950u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 11 && H_PHASH_SLOT(H_PHASH_HASH(0x000b3950u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 1 ? 1 : -1];
+typedef char opcodes_phash_check_2[H_PHASH_BUCKET(H_PHASH_HASH(0x0001818fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 55 && H_PHASH_SLOT(H_PHASH_HASH(0x0001818fu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 2 ? 1 : -1];
+typedef char opcodes_phash_check_4[H_PHASH_BUCKET(H_PHASH_HASH(0x000bb2d5u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 23 && H_PHASH_SLOT(H_PHASH_HASH(0x000bb2d5u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 4 ? 1 : -1];
+typedef char opcodes_phash_check_5[H_PHASH_BUCKET(H_PHASH_HASH(0x0000f17bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 53 && H_PHASH_SLOT(H_PHASH_HASH(0x0000f17bu, OPCODES_SEED), 20, OPCODES_SLOT_BITS) == 5 ? 1 : -1];
+typedef char opcodes_phash_check_6[H_PHASH_BUCKET(H_PHASH_HASH(0x0006cad5u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 61 && H_PHASH_SLOT(H_PHASH_HASH(0x0006cad5u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 6 ? 1 : -1];
+typedef char opcodes_phash_check_7[H_PHASH_BUCKET(H_PHASH_HASH(0x000930d7u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 53 && H_PHASH_SLOT(H_PHASH_HASH(0x000930d7u, OPCODES_SEED), 20, OPCODES_SLOT_BITS) == 7 ? 1 : -1];
+typedef char opcodes_phash_check_8[H_PHASH_BUCKET(H_PHASH_HASH(0x0005bd87u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 13 && H_PHASH_SLOT(H_PHASH_HASH(0x0005bd87u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 8 ? 1 : -1];
+typedef char opcodes_phash_check_9[H_PHASH_BUCKET(H_PHASH_HASH(0x0005d9ddu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 1 && H_PHASH_SLOT(H_PHASH_HASH(0x0005d9ddu, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 9 ? 1 : -1];
+typedef char opcodes_phash_check_11[H_PHASH_BUCKET(H_PHASH_HASH(0x0007f1b2u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 9 && H_PHASH_SLOT(H_PHASH_HASH(0x0007f1b2u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 11 ? 1 : -1];
+typedef char opcodes_phash_check_12[H_PHASH_BUCKET(H_PHASH_HASH(0x000bd057u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 3 && H_PHASH_SLOT(H_PHASH_HASH(0x000bd057u, OPCODES_SEED), 7, OPCODES_SLOT_BITS) == 12 ? 1 : -1];
+typedef char opcodes_phash_check_15[H_PHASH_BUCKET(H_PHASH_HASH(0x00057910u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 34 && H_PHASH_SLOT(H_PHASH_HASH(0x00057910u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 15 ? 1 : -1];
+typedef char opcodes_phash_check_16[H_PHASH_BUCKET(H_PHASH_HASH(0x00037dc8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 16 && H_PHASH_SLOT(H_PHASH_HASH(0x00037dc8u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 16 ? 1 : -1];
+typedef char opcodes_phash_check_17[H_PHASH_BUCKET(H_PHASH_HASH(0x0001e27bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 17 && H_PHASH_SLOT(H_PHASH_HASH(0x0001e27bu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 17 ? 1 : -1];
+typedef char opcodes_phash_check_18[H_PHASH_BUCKET(H_PHASH_HASH(0x00058d56u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 57 && H_PHASH_SLOT(H_PHASH_HASH(0x00058d56u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 18 ? 1 : -1];
+typedef char opcodes_phash_check_19[H_PHASH_BUCKET(H_PHASH_HASH(0x00009996u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 12 && H_PHASH_SLOT(H_PHASH_HASH(0x00009996u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 19 ? 1 : -1];
+typedef char opcodes_phash_check_20[H_PHASH_BUCKET(H_PHASH_HASH(0x0007d2cbu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 38 && H_PHASH_SLOT(H_PHASH_HASH(0x0007d2cbu, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 20 ? 1 : -1];
+typedef char opcodes_phash_check_21[H_PHASH_BUCKET(H_PHASH_HASH(0x000e25a8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 4 && H_PHASH_SLOT(H_PHASH_HASH(0x000e25a8u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 21 ? 1 : -1];
+typedef char opcodes_phash_check_22[H_PHASH_BUCKET(H_PHASH_HASH(0x000d7083u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 58 && H_PHASH_SLOT(H_PHASH_HASH(0x000d7083u, OPCODES_SEED), 6, OPCODES_SLOT_BITS) == 22 ? 1 : -1];
+typedef char opcodes_phash_check_23[H_PHASH_BUCKET(H_PHASH_HASH(0x000892fau, OPCODES_SEED), OPCODES_BUCKET_BITS) == 30 && H_PHASH_SLOT(H_PHASH_HASH(0x000892fau, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 23 ? 1 : -1];
+typedef char opcodes_phash_check_24[H_PHASH_BUCKET(H_PHASH_HASH(0x0006b0d6u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 20 && H_PHASH_SLOT(H_PHASH_HASH(0x0006b0d6u, OPCODES_SEED), 21, OPCODES_SLOT_BITS) == 24 ? 1 : -1];
+typedef char opcodes_phash_check_25[H_PHASH_BUCKET(H_PHASH_HASH(0x000b2f15u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 46 && H_PHASH_SLOT(H_PHASH_HASH(0x000b2f15u, OPCODES_SEED), 7, OPCODES_SLOT_BITS) == 25 ? 1 : -1];
+typedef char opcodes_phash_check_26[H_PHASH_BUCKET(H_PHASH_HASH(0x000d269bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 59 && H_PHASH_SLOT(H_PHASH_HASH(0x000d269bu, OPCODES_SEED), 6, OPCODES_SLOT_BITS) == 26 ? 1 : -1];
+typedef char opcodes_phash_check_27[H_PHASH_BUCKET(H_PHASH_HASH(0x0008ede1u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 24 && H_PHASH_SLOT(H_PHASH_HASH(0x0008ede1u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 27 ? 1 : -1];
+typedef char opcodes_phash_check_28[H_PHASH_BUCKET(H_PHASH_HASH(0x00074c9eu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 54 && H_PHASH_SLOT(H_PHASH_HASH(0x00074c9eu, OPCODES_SEED), 8, OPCODES_SLOT_BITS) == 28 ? 1 : -1];
+typedef char opcodes_phash_check_29[H_PHASH_BUCKET(H_PHASH_HASH(0x000d3acau, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x000d3acau, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 29 ? 1 : -1];
+typedef char opcodes_phash_check_31[H_PHASH_BUCKET(H_PHASH_HASH(0x0008cdb4u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 16 && H_PHASH_SLOT(H_PHASH_HASH(0x0008cdb4u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 31 ? 1 : -1];
+typedef char opcodes_phash_check_32[H_PHASH_BUCKET(H_PHASH_HASH(0x000ae659u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 24 && H_PHASH_SLOT(H_PHASH_HASH(0x000ae659u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 32 ? 1 : -1];
+typedef char opcodes_phash_check_33[H_PHASH_BUCKET(H_PHASH_HASH(0x0000f21eu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 37 && H_PHASH_SLOT(H_PHASH_HASH(0x0000f21eu, OPCODES_SEED), 14, OPCODES_SLOT_BITS) == 33 ? 1 : -1];
+typedef char opcodes_phash_check_34[H_PHASH_BUCKET(H_PHASH_HASH(0x0001e399u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 2 && H_PHASH_SLOT(H_PHASH_HASH(0x0001e399u, OPCODES_SEED), 23, OPCODES_SLOT_BITS) == 34 ? 1 : -1];
+typedef char opcodes_phash_check_35[H_PHASH_BUCKET(H_PHASH_HASH(0x0007631bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 40 && H_PHASH_SLOT(H_PHASH_HASH(0x0007631bu, OPCODES_SEED), 6, OPCODES_SLOT_BITS) == 35 ? 1 : -1];
+typedef char opcodes_phash_check_36[H_PHASH_BUCKET(H_PHASH_HASH(0x00072159u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 11 && H_PHASH_SLOT(H_PHASH_HASH(0x00072159u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 36 ? 1 : -1];
+typedef char opcodes_phash_check_37[H_PHASH_BUCKET(H_PHASH_HASH(0x0000f881u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 52 && H_PHASH_SLOT(H_PHASH_HASH(0x0000f881u, OPCODES_SEED), 19, OPCODES_SLOT_BITS) == 37 ? 1 : -1];
+typedef char opcodes_phash_check_38[H_PHASH_BUCKET(H_PHASH_HASH(0x000451acu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 26 && H_PHASH_SLOT(H_PHASH_HASH(0x000451acu, OPCODES_SEED), 8, OPCODES_SLOT_BITS) == 38 ? 1 : -1];
+typedef char opcodes_phash_check_39[H_PHASH_BUCKET(H_PHASH_HASH(0x00039264u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 55 && H_PHASH_SLOT(H_PHASH_HASH(0x00039264u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 39 ? 1 : -1];
+typedef char opcodes_phash_check_40[H_PHASH_BUCKET(H_PHASH_HASH(0x0003e7d2u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 6 && H_PHASH_SLOT(H_PHASH_HASH(0x0003e7d2u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 40 ? 1 : -1];
+typedef char opcodes_phash_check_41[H_PHASH_BUCKET(H_PHASH_HASH(0x0000ed91u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 16 && H_PHASH_SLOT(H_PHASH_HASH(0x0000ed91u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 41 ? 1 : -1];
+typedef char opcodes_phash_check_43[H_PHASH_BUCKET(H_PHASH_HASH(0x000dbc4au, OPCODES_SEED), OPCODES_BUCKET_BITS) == 8 && H_PHASH_SLOT(H_PHASH_HASH(0x000dbc4au, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 43 ? 1 : -1];
+typedef char opcodes_phash_check_44[H_PHASH_BUCKET(H_PHASH_HASH(0x000b774fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 45 && H_PHASH_SLOT(H_PHASH_HASH(0x000b774fu, OPCODES_SEED), 22, OPCODES_SLOT_BITS) == 44 ? 1 : -1];
+typedef char opcodes_phash_check_45[H_PHASH_BUCKET(H_PHASH_HASH(0x0008d117u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 60 && H_PHASH_SLOT(H_PHASH_HASH(0x0008d117u, OPCODES_SEED), 7, OPCODES_SLOT_BITS) == 45 ? 1 : -1];
+typedef char opcodes_phash_check_46[H_PHASH_BUCKET(H_PHASH_HASH(0x0000cb1fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 11 && H_PHASH_SLOT(H_PHASH_HASH(0x0000cb1fu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 46 ? 1 : -1];
+typedef char opcodes_phash_check_48[H_PHASH_BUCKET(H_PHASH_HASH(0x0000fd64u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 61 && H_PHASH_SLOT(H_PHASH_HASH(0x0000fd64u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 48 ? 1 : -1];
+typedef char opcodes_phash_check_49[H_PHASH_BUCKET(H_PHASH_HASH(0x000d17fau, OPCODES_SEED), OPCODES_BUCKET_BITS) == 61 && H_PHASH_SLOT(H_PHASH_HASH(0x000d17fau, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 49 ? 1 : -1];
+typedef char opcodes_phash_check_50[H_PHASH_BUCKET(H_PHASH_HASH(0x00024edfu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x00024edfu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 50 ? 1 : -1];
+typedef char opcodes_phash_check_51[H_PHASH_BUCKET(H_PHASH_HASH(0x00066d23u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 33 && H_PHASH_SLOT(H_PHASH_HASH(0x00066d23u, OPCODES_SEED), 12, OPCODES_SLOT_BITS) == 51 ? 1 : -1];
+typedef char opcodes_phash_check_53[H_PHASH_BUCKET(H_PHASH_HASH(0x0006164au, OPCODES_SEED), OPCODES_BUCKET_BITS) == 52 && H_PHASH_SLOT(H_PHASH_HASH(0x0006164au, OPCODES_SEED), 19, OPCODES_SLOT_BITS) == 53 ? 1 : -1];
+typedef char opcodes_phash_check_54[H_PHASH_BUCKET(H_PHASH_HASH(0x00095e77u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 8 && H_PHASH_SLOT(H_PHASH_HASH(0x00095e77u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 54 ? 1 : -1];
+typedef char opcodes_phash_check_56[H_PHASH_BUCKET(H_PHASH_HASH(0x000fe3b9u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 16 && H_PHASH_SLOT(H_PHASH_HASH(0x000fe3b9u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 56 ? 1 : -1];
+typedef char opcodes_phash_check_57[H_PHASH_BUCKET(H_PHASH_HASH(0x00094741u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 28 && H_PHASH_SLOT(H_PHASH_HASH(0x00094741u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 57 ? 1 : -1];
+typedef char opcodes_phash_check_58[H_PHASH_BUCKET(H_PHASH_HASH(0x00093bd1u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 39 && H_PHASH_SLOT(H_PHASH_HASH(0x00093bd1u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 58 ? 1 : -1];
+typedef char opcodes_phash_check_59[H_PHASH_BUCKET(H_PHASH_HASH(0x00017f5fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 35 && H_PHASH_SLOT(H_PHASH_HASH(0x00017f5fu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 59 ? 1 : -1];
+typedef char opcodes_phash_check_60[H_PHASH_BUCKET(H_PHASH_HASH(0x0005051du, OPCODES_SEED), OPCODES_BUCKET_BITS) == 62 && H_PHASH_SLOT(H_PHASH_HASH(0x0005051du, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 60 ? 1 : -1];
+typedef char opcodes_phash_check_62[H_PHASH_BUCKET(H_PHASH_HASH(0x000230dau, OPCODES_SEED), OPCODES_BUCKET_BITS) == 54 && H_PHASH_SLOT(H_PHASH_HASH(0x000230dau, OPCODES_SEED), 8, OPCODES_SLOT_BITS) == 62 ? 1 : -1];
+typedef char opcodes_phash_check_63[H_PHASH_BUCKET(H_PHASH_HASH(0x00072fe0u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 22 && H_PHASH_SLOT(H_PHASH_HASH(0x00072fe0u, OPCODES_SEED), 18, OPCODES_SLOT_BITS) == 63 ? 1 : -1];
+typedef char opcodes_phash_check_64[H_PHASH_BUCKET(H_PHASH_HASH(0x000269e1u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 53 && H_PHASH_SLOT(H_PHASH_HASH(0x000269e1u, OPCODES_SEED), 20, OPCODES_SLOT_BITS) == 64 ? 1 : -1];
+typedef char opcodes_phash_check_66[H_PHASH_BUCKET(H_PHASH_HASH(0x000c7a2fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 24 && H_PHASH_SLOT(H_PHASH_HASH(0x000c7a2fu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 66 ? 1 : -1];
+typedef char opcodes_phash_check_67[H_PHASH_BUCKET(H_PHASH_HASH(0x0002e442u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 46 && H_PHASH_SLOT(H_PHASH_HASH(0x0002e442u, OPCODES_SEED), 7, OPCODES_SLOT_BITS) == 67 ? 1 : -1];
+typedef char opcodes_phash_check_69[H_PHASH_BUCKET(H_PHASH_HASH(0x0006b0a2u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 0 && H_PHASH_SLOT(H_PHASH_HASH(0x0006b0a2u, OPCODES_SEED), 12, OPCODES_SLOT_BITS) == 69 ? 1 : -1];
+typedef char opcodes_phash_check_70[H_PHASH_BUCKET(H_PHASH_HASH(0x0006b4ccu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 53 && H_PHASH_SLOT(H_PHASH_HASH(0x0006b4ccu, OPCODES_SEED), 20, OPCODES_SLOT_BITS) == 70 ? 1 : -1];
+typedef char opcodes_phash_check_72[H_PHASH_BUCKET(H_PHASH_HASH(0x0003f98fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 35 && H_PHASH_SLOT(H_PHASH_HASH(0x0003f98fu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 72 ? 1 : -1];
+typedef char opcodes_phash_check_73[H_PHASH_BUCKET(H_PHASH_HASH(0x000f2a75u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 45 && H_PHASH_SLOT(H_PHASH_HASH(0x000f2a75u, OPCODES_SEED), 22, OPCODES_SLOT_BITS) == 73 ? 1 : -1];
+typedef char opcodes_phash_check_74[H_PHASH_BUCKET(H_PHASH_HASH(0x00094e3cu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 30 && H_PHASH_SLOT(H_PHASH_HASH(0x00094e3cu, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 74 ? 1 : -1];
+typedef char opcodes_phash_check_75[H_PHASH_BUCKET(H_PHASH_HASH(0x0004cbd9u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x0004cbd9u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 75 ? 1 : -1];
+typedef char opcodes_phash_check_76[H_PHASH_BUCKET(H_PHASH_HASH(0x00092277u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 50 && H_PHASH_SLOT(H_PHASH_HASH(0x00092277u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 76 ? 1 : -1];
+typedef char opcodes_phash_check_77[H_PHASH_BUCKET(H_PHASH_HASH(0x000ca022u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 44 && H_PHASH_SLOT(H_PHASH_HASH(0x000ca022u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 77 ? 1 : -1];
+typedef char opcodes_phash_check_78[H_PHASH_BUCKET(H_PHASH_HASH(0x0008f6d1u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 32 && H_PHASH_SLOT(H_PHASH_HASH(0x0008f6d1u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 78 ? 1 : -1];
+typedef char opcodes_phash_check_79[H_PHASH_BUCKET(H_PHASH_HASH(0x000a38feu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 48 && H_PHASH_SLOT(H_PHASH_HASH(0x000a38feu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 79 ? 1 : -1];
+typedef char opcodes_phash_check_80[H_PHASH_BUCKET(H_PHASH_HASH(0x0004f427u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 28 && H_PHASH_SLOT(H_PHASH_HASH(0x0004f427u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 80 ? 1 : -1];
+typedef char opcodes_phash_check_81[H_PHASH_BUCKET(H_PHASH_HASH(0x0009c654u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 63 && H_PHASH_SLOT(H_PHASH_HASH(0x0009c654u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 81 ? 1 : -1];
+typedef char opcodes_phash_check_82[H_PHASH_BUCKET(H_PHASH_HASH(0x000ab2ceu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 34 && H_PHASH_SLOT(H_PHASH_HASH(0x000ab2ceu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 82 ? 1 : -1];
+typedef char opcodes_phash_check_83[H_PHASH_BUCKET(H_PHASH_HASH(0x000e2258u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 22 && H_PHASH_SLOT(H_PHASH_HASH(0x000e2258u, OPCODES_SEED), 18, OPCODES_SLOT_BITS) == 83 ? 1 : -1];
+typedef char opcodes_phash_check_84[H_PHASH_BUCKET(H_PHASH_HASH(0x0004a23eu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 34 && H_PHASH_SLOT(H_PHASH_HASH(0x0004a23eu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 84 ? 1 : -1];
+typedef char opcodes_phash_check_85[H_PHASH_BUCKET(H_PHASH_HASH(0x00010a3eu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 2 && H_PHASH_SLOT(H_PHASH_HASH(0x00010a3eu, OPCODES_SEED), 23, OPCODES_SLOT_BITS) == 85 ? 1 : -1];
+typedef char opcodes_phash_check_86[H_PHASH_BUCKET(H_PHASH_HASH(0x00005c6bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 20 && H_PHASH_SLOT(H_PHASH_HASH(0x00005c6bu, OPCODES_SEED), 21, OPCODES_SLOT_BITS) == 86 ? 1 : -1];
+typedef char opcodes_phash_check_87[H_PHASH_BUCKET(H_PHASH_HASH(0x0000beceu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x0000beceu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 87 ? 1 : -1];
+typedef char opcodes_phash_check_88[H_PHASH_BUCKET(H_PHASH_HASH(0x000658ceu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 51 && H_PHASH_SLOT(H_PHASH_HASH(0x000658ceu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 88 ? 1 : -1];
+typedef char opcodes_phash_check_90[H_PHASH_BUCKET(H_PHASH_HASH(0x0001fb18u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 53 && H_PHASH_SLOT(H_PHASH_HASH(0x0001fb18u, OPCODES_SEED), 20, OPCODES_SLOT_BITS) == 90 ? 1 : -1];
+typedef char opcodes_phash_check_94[H_PHASH_BUCKET(H_PHASH_HASH(0x0007f151u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 36 && H_PHASH_SLOT(H_PHASH_HASH(0x0007f151u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 94 ? 1 : -1];
+typedef char opcodes_phash_check_95[H_PHASH_BUCKET(H_PHASH_HASH(0x000ab104u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 35 && H_PHASH_SLOT(H_PHASH_HASH(0x000ab104u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 95 ? 1 : -1];
+typedef char opcodes_phash_check_96[H_PHASH_BUCKET(H_PHASH_HASH(0x000830e1u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 17 && H_PHASH_SLOT(H_PHASH_HASH(0x000830e1u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 96 ? 1 : -1];
+typedef char opcodes_phash_check_97[H_PHASH_BUCKET(H_PHASH_HASH(0x000e01f6u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 6 && H_PHASH_SLOT(H_PHASH_HASH(0x000e01f6u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 97 ? 1 : -1];
+typedef char opcodes_phash_check_99[H_PHASH_BUCKET(H_PHASH_HASH(0x000f646fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x000f646fu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 99 ? 1 : -1];
+typedef char opcodes_phash_check_100[H_PHASH_BUCKET(H_PHASH_HASH(0x000babcfu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 32 && H_PHASH_SLOT(H_PHASH_HASH(0x000babcfu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 100 ? 1 : -1];
+typedef char opcodes_phash_check_101[H_PHASH_BUCKET(H_PHASH_HASH(0x00093f45u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x00093f45u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 101 ? 1 : -1];
+typedef char opcodes_phash_check_104[H_PHASH_BUCKET(H_PHASH_HASH(0x00059a55u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 59 && H_PHASH_SLOT(H_PHASH_HASH(0x00059a55u, OPCODES_SEED), 6, OPCODES_SLOT_BITS) == 104 ? 1 : -1];
+typedef char opcodes_phash_check_106[H_PHASH_BUCKET(H_PHASH_HASH(0x00052e6cu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 13 && H_PHASH_SLOT(H_PHASH_HASH(0x00052e6cu, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 106 ? 1 : -1];
+typedef char opcodes_phash_check_107[H_PHASH_BUCKET(H_PHASH_HASH(0x000c6f88u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 58 && H_PHASH_SLOT(H_PHASH_HASH(0x000c6f88u, OPCODES_SEED), 6, OPCODES_SLOT_BITS) == 107 ? 1 : -1];
+typedef char opcodes_phash_check_108[H_PHASH_BUCKET(H_PHASH_HASH(0x00057ee1u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 23 && H_PHASH_SLOT(H_PHASH_HASH(0x00057ee1u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 108 ? 1 : -1];
+typedef char opcodes_phash_check_109[H_PHASH_BUCKET(H_PHASH_HASH(0x000b4d67u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x000b4d67u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 109 ? 1 : -1];
+typedef char opcodes_phash_check_112[H_PHASH_BUCKET(H_PHASH_HASH(0x0002e054u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 34 && H_PHASH_SLOT(H_PHASH_HASH(0x0002e054u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 112 ? 1 : -1];
+typedef char opcodes_phash_check_115[H_PHASH_BUCKET(H_PHASH_HASH(0x00018f14u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 8 && H_PHASH_SLOT(H_PHASH_HASH(0x00018f14u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 115 ? 1 : -1];
+typedef char opcodes_phash_check_116[H_PHASH_BUCKET(H_PHASH_HASH(0x0003b129u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 11 && H_PHASH_SLOT(H_PHASH_HASH(0x0003b129u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 116 ? 1 : -1];
+typedef char opcodes_phash_check_117[H_PHASH_BUCKET(H_PHASH_HASH(0x00092b1eu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 38 && H_PHASH_SLOT(H_PHASH_HASH(0x00092b1eu, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 117 ? 1 : -1];
+typedef char opcodes_phash_check_118[H_PHASH_BUCKET(H_PHASH_HASH(0x0006f037u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 1 && H_PHASH_SLOT(H_PHASH_HASH(0x0006f037u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 118 ? 1 : -1];
+typedef char opcodes_phash_check_120[H_PHASH_BUCKET(H_PHASH_HASH(0x000cb5c8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 18 && H_PHASH_SLOT(H_PHASH_HASH(0x000cb5c8u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 120 ? 1 : -1];
+typedef char opcodes_phash_check_122[H_PHASH_BUCKET(H_PHASH_HASH(0x0006bf47u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 34 && H_PHASH_SLOT(H_PHASH_HASH(0x0006bf47u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 122 ? 1 : -1];
+typedef char opcodes_phash_check_123[H_PHASH_BUCKET(H_PHASH_HASH(0x000eeeadu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 33 && H_PHASH_SLOT(H_PHASH_HASH(0x000eeeadu, OPCODES_SEED), 12, OPCODES_SLOT_BITS) == 123 ? 1 : -1];
+typedef char opcodes_phash_check_125[H_PHASH_BUCKET(H_PHASH_HASH(0x000795e9u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 9 && H_PHASH_SLOT(H_PHASH_HASH(0x000795e9u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 125 ? 1 : -1];
+typedef char opcodes_phash_check_126[H_PHASH_BUCKET(H_PHASH_HASH(0x000f0ce6u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 18 && H_PHASH_SLOT(H_PHASH_HASH(0x000f0ce6u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 126 ? 1 : -1];
+typedef char opcodes_phash_check_127[H_PHASH_BUCKET(H_PHASH_HASH(0x000b2716u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 34 && H_PHASH_SLOT(H_PHASH_HASH(0x000b2716u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 127 ? 1 : -1];
+typedef char opcodes_phash_check_129[H_PHASH_BUCKET(H_PHASH_HASH(0x0006e36bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 32 && H_PHASH_SLOT(H_PHASH_HASH(0x0006e36bu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 129 ? 1 : -1];
+typedef char opcodes_phash_check_130[H_PHASH_BUCKET(H_PHASH_HASH(0x0000a098u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x0000a098u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 130 ? 1 : -1];
+typedef char opcodes_phash_check_132[H_PHASH_BUCKET(H_PHASH_HASH(0x000506c0u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 34 && H_PHASH_SLOT(H_PHASH_HASH(0x000506c0u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 132 ? 1 : -1];
+typedef char opcodes_phash_check_133[H_PHASH_BUCKET(H_PHASH_HASH(0x000119a8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 17 && H_PHASH_SLOT(H_PHASH_HASH(0x000119a8u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 133 ? 1 : -1];
+typedef char opcodes_phash_check_134[H_PHASH_BUCKET(H_PHASH_HASH(0x000faeccu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 42 && H_PHASH_SLOT(H_PHASH_HASH(0x000faeccu, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 134 ? 1 : -1];
+typedef char opcodes_phash_check_135[H_PHASH_BUCKET(H_PHASH_HASH(0x000ae97cu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 18 && H_PHASH_SLOT(H_PHASH_HASH(0x000ae97cu, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 135 ? 1 : -1];
+typedef char opcodes_phash_check_136[H_PHASH_BUCKET(H_PHASH_HASH(0x00012bd5u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 56 && H_PHASH_SLOT(H_PHASH_HASH(0x00012bd5u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 136 ? 1 : -1];
+typedef char opcodes_phash_check_137[H_PHASH_BUCKET(H_PHASH_HASH(0x0008ca82u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 28 && H_PHASH_SLOT(H_PHASH_HASH(0x0008ca82u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 137 ? 1 : -1];
+typedef char opcodes_phash_check_138[H_PHASH_BUCKET(H_PHASH_HASH(0x0007731bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x0007731bu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 138 ? 1 : -1];
+typedef char opcodes_phash_check_139[H_PHASH_BUCKET(H_PHASH_HASH(0x0002a3b0u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 15 && H_PHASH_SLOT(H_PHASH_HASH(0x0002a3b0u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 139 ? 1 : -1];
+typedef char opcodes_phash_check_140[H_PHASH_BUCKET(H_PHASH_HASH(0x0000c5c8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x0000c5c8u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 140 ? 1 : -1];
+typedef char opcodes_phash_check_141[H_PHASH_BUCKET(H_PHASH_HASH(0x000eab48u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 45 && H_PHASH_SLOT(H_PHASH_HASH(0x000eab48u, OPCODES_SEED), 22, OPCODES_SLOT_BITS) == 141 ? 1 : -1];
+typedef char opcodes_phash_check_142[H_PHASH_BUCKET(H_PHASH_HASH(0x000c3bafu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 38 && H_PHASH_SLOT(H_PHASH_HASH(0x000c3bafu, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 142 ? 1 : -1];
+typedef char opcodes_phash_check_144[H_PHASH_BUCKET(H_PHASH_HASH(0x000211c8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 10 && H_PHASH_SLOT(H_PHASH_HASH(0x000211c8u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 144 ? 1 : -1];
+typedef char opcodes_phash_check_146[H_PHASH_BUCKET(H_PHASH_HASH(0x0001dfa0u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 56 && H_PHASH_SLOT(H_PHASH_HASH(0x0001dfa0u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 146 ? 1 : -1];
+typedef char opcodes_phash_check_147[H_PHASH_BUCKET(H_PHASH_HASH(0x000ec66bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x000ec66bu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 147 ? 1 : -1];
+typedef char opcodes_phash_check_148[H_PHASH_BUCKET(H_PHASH_HASH(0x000aec70u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 0 && H_PHASH_SLOT(H_PHASH_HASH(0x000aec70u, OPCODES_SEED), 12, OPCODES_SLOT_BITS) == 148 ? 1 : -1];
+typedef char opcodes_phash_check_149[H_PHASH_BUCKET(H_PHASH_HASH(0x00030186u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 19 && H_PHASH_SLOT(H_PHASH_HASH(0x00030186u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 149 ? 1 : -1];
+typedef char opcodes_phash_check_153[H_PHASH_BUCKET(H_PHASH_HASH(0x000a5aa4u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 56 && H_PHASH_SLOT(H_PHASH_HASH(0x000a5aa4u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 153 ? 1 : -1];
+typedef char opcodes_phash_check_154[H_PHASH_BUCKET(H_PHASH_HASH(0x0007403fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 61 && H_PHASH_SLOT(H_PHASH_HASH(0x0007403fu, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 154 ? 1 : -1];
+typedef char opcodes_phash_check_155[H_PHASH_BUCKET(H_PHASH_HASH(0x00095e61u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 58 && H_PHASH_SLOT(H_PHASH_HASH(0x00095e61u, OPCODES_SEED), 6, OPCODES_SLOT_BITS) == 155 ? 1 : -1];
+typedef char opcodes_phash_check_157[H_PHASH_BUCKET(H_PHASH_HASH(0x000a09f8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 10 && H_PHASH_SLOT(H_PHASH_HASH(0x000a09f8u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 157 ? 1 : -1];
+typedef char opcodes_phash_check_158[H_PHASH_BUCKET(H_PHASH_HASH(0x00014a10u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 47 && H_PHASH_SLOT(H_PHASH_HASH(0x00014a10u, OPCODES_SEED), 14, OPCODES_SLOT_BITS) == 158 ? 1 : -1];
+typedef char opcodes_phash_check_160[H_PHASH_BUCKET(H_PHASH_HASH(0x000a6a3bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x000a6a3bu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 160 ? 1 : -1];
+typedef char opcodes_phash_check_161[H_PHASH_BUCKET(H_PHASH_HASH(0x000e3152u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 63 && H_PHASH_SLOT(H_PHASH_HASH(0x000e3152u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 161 ? 1 : -1];
+typedef char opcodes_phash_check_166[H_PHASH_BUCKET(H_PHASH_HASH(0x00034b9cu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 22 && H_PHASH_SLOT(H_PHASH_HASH(0x00034b9cu, OPCODES_SEED), 18, OPCODES_SLOT_BITS) == 166 ? 1 : -1];
+typedef char opcodes_phash_check_168[H_PHASH_BUCKET(H_PHASH_HASH(0x0004cdd3u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 38 && H_PHASH_SLOT(H_PHASH_HASH(0x0004cdd3u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 168 ? 1 : -1];
+typedef char opcodes_phash_check_170[H_PHASH_BUCKET(H_PHASH_HASH(0x00011e21u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x00011e21u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 170 ? 1 : -1];
+typedef char opcodes_phash_check_171[H_PHASH_BUCKET(H_PHASH_HASH(0x000c4aafu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 55 && H_PHASH_SLOT(H_PHASH_HASH(0x000c4aafu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 171 ? 1 : -1];
+typedef char opcodes_phash_check_172[H_PHASH_BUCKET(H_PHASH_HASH(0x0003898eu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 6 && H_PHASH_SLOT(H_PHASH_HASH(0x0003898eu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 172 ? 1 : -1];
+typedef char opcodes_phash_check_173[H_PHASH_BUCKET(H_PHASH_HASH(0x000b64cfu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 14 && H_PHASH_SLOT(H_PHASH_HASH(0x000b64cfu, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 173 ? 1 : -1];
+typedef char opcodes_phash_check_174[H_PHASH_BUCKET(H_PHASH_HASH(0x00036f68u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 33 && H_PHASH_SLOT(H_PHASH_HASH(0x00036f68u, OPCODES_SEED), 12, OPCODES_SLOT_BITS) == 174 ? 1 : -1];
+typedef char opcodes_phash_check_175[H_PHASH_BUCKET(H_PHASH_HASH(0x000953f5u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 22 && H_PHASH_SLOT(H_PHASH_HASH(0x000953f5u, OPCODES_SEED), 18, OPCODES_SLOT_BITS) == 175 ? 1 : -1];
+typedef char opcodes_phash_check_177[H_PHASH_BUCKET(H_PHASH_HASH(0x00048db5u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 12 && H_PHASH_SLOT(H_PHASH_HASH(0x00048db5u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 177 ? 1 : -1];
+typedef char opcodes_phash_check_179[H_PHASH_BUCKET(H_PHASH_HASH(0x00062c34u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 29 && H_PHASH_SLOT(H_PHASH_HASH(0x00062c34u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 179 ? 1 : -1];
+typedef char opcodes_phash_check_180[H_PHASH_BUCKET(H_PHASH_HASH(0x000f52deu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 34 && H_PHASH_SLOT(H_PHASH_HASH(0x000f52deu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 180 ? 1 : -1];
+typedef char opcodes_phash_check_182[H_PHASH_BUCKET(H_PHASH_HASH(0x000aa05fu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 5 && H_PHASH_SLOT(H_PHASH_HASH(0x000aa05fu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 182 ? 1 : -1];
+typedef char opcodes_phash_check_183[H_PHASH_BUCKET(H_PHASH_HASH(0x00064155u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 11 && H_PHASH_SLOT(H_PHASH_HASH(0x00064155u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 183 ? 1 : -1];
+typedef char opcodes_phash_check_184[H_PHASH_BUCKET(H_PHASH_HASH(0x00090c1au, OPCODES_SEED), OPCODES_BUCKET_BITS) == 23 && H_PHASH_SLOT(H_PHASH_HASH(0x00090c1au, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 184 ? 1 : -1];
+typedef char opcodes_phash_check_185[H_PHASH_BUCKET(H_PHASH_HASH(0x00057125u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 17 && H_PHASH_SLOT(H_PHASH_HASH(0x00057125u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 185 ? 1 : -1];
+typedef char opcodes_phash_check_186[H_PHASH_BUCKET(H_PHASH_HASH(0x000df159u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 28 && H_PHASH_SLOT(H_PHASH_HASH(0x000df159u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 186 ? 1 : -1];
+typedef char opcodes_phash_check_187[H_PHASH_BUCKET(H_PHASH_HASH(0x0006a50eu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 26 && H_PHASH_SLOT(H_PHASH_HASH(0x0006a50eu, OPCODES_SEED), 8, OPCODES_SLOT_BITS) == 187 ? 1 : -1];
+typedef char opcodes_phash_check_188[H_PHASH_BUCKET(H_PHASH_HASH(0x000a170cu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 32 && H_PHASH_SLOT(H_PHASH_HASH(0x000a170cu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 188 ? 1 : -1];
+typedef char opcodes_phash_check_189[H_PHASH_BUCKET(H_PHASH_HASH(0x0005c90bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 36 && H_PHASH_SLOT(H_PHASH_HASH(0x0005c90bu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 189 ? 1 : -1];
+typedef char opcodes_phash_check_190[H_PHASH_BUCKET(H_PHASH_HASH(0x0006d76cu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 16 && H_PHASH_SLOT(H_PHASH_HASH(0x0006d76cu, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 190 ? 1 : -1];
+typedef char opcodes_phash_check_191[H_PHASH_BUCKET(H_PHASH_HASH(0x000128b3u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 60 && H_PHASH_SLOT(H_PHASH_HASH(0x000128b3u, OPCODES_SEED), 7, OPCODES_SLOT_BITS) == 191 ? 1 : -1];
+typedef char opcodes_phash_check_192[H_PHASH_BUCKET(H_PHASH_HASH(0x00026e88u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x00026e88u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 192 ? 1 : -1];
+typedef char opcodes_phash_check_194[H_PHASH_BUCKET(H_PHASH_HASH(0x000f29d1u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 17 && H_PHASH_SLOT(H_PHASH_HASH(0x000f29d1u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 194 ? 1 : -1];
+typedef char opcodes_phash_check_195[H_PHASH_BUCKET(H_PHASH_HASH(0x0007f262u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 17 && H_PHASH_SLOT(H_PHASH_HASH(0x0007f262u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 195 ? 1 : -1];
+typedef char opcodes_phash_check_196[H_PHASH_BUCKET(H_PHASH_HASH(0x0001600bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 27 && H_PHASH_SLOT(H_PHASH_HASH(0x0001600bu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 196 ? 1 : -1];
+typedef char opcodes_phash_check_198[H_PHASH_BUCKET(H_PHASH_HASH(0x000d23f1u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 8 && H_PHASH_SLOT(H_PHASH_HASH(0x000d23f1u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 198 ? 1 : -1];
+typedef char opcodes_phash_check_199[H_PHASH_BUCKET(H_PHASH_HASH(0x0008e81au, OPCODES_SEED), OPCODES_BUCKET_BITS) == 54 && H_PHASH_SLOT(H_PHASH_HASH(0x0008e81au, OPCODES_SEED), 8, OPCODES_SLOT_BITS) == 199 ? 1 : -1];
+typedef char opcodes_phash_check_200[H_PHASH_BUCKET(H_PHASH_HASH(0x0009531au, OPCODES_SEED), OPCODES_BUCKET_BITS) == 55 && H_PHASH_SLOT(H_PHASH_HASH(0x0009531au, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 200 ? 1 : -1];
+typedef char opcodes_phash_check_201[H_PHASH_BUCKET(H_PHASH_HASH(0x00047208u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 15 && H_PHASH_SLOT(H_PHASH_HASH(0x00047208u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 201 ? 1 : -1];
+typedef char opcodes_phash_check_202[H_PHASH_BUCKET(H_PHASH_HASH(0x000881eeu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 24 && H_PHASH_SLOT(H_PHASH_HASH(0x000881eeu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 202 ? 1 : -1];
+typedef char opcodes_phash_check_203[H_PHASH_BUCKET(H_PHASH_HASH(0x000cc012u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 28 && H_PHASH_SLOT(H_PHASH_HASH(0x000cc012u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 203 ? 1 : -1];
+typedef char opcodes_phash_check_204[H_PHASH_BUCKET(H_PHASH_HASH(0x0009828au, OPCODES_SEED), OPCODES_BUCKET_BITS) == 50 && H_PHASH_SLOT(H_PHASH_HASH(0x0009828au, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 204 ? 1 : -1];
+typedef char opcodes_phash_check_205[H_PHASH_BUCKET(H_PHASH_HASH(0x0003f63bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 41 && H_PHASH_SLOT(H_PHASH_HASH(0x0003f63bu, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 205 ? 1 : -1];
+typedef char opcodes_phash_check_206[H_PHASH_BUCKET(H_PHASH_HASH(0x000d1bc6u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 17 && H_PHASH_SLOT(H_PHASH_HASH(0x000d1bc6u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 206 ? 1 : -1];
+typedef char opcodes_phash_check_207[H_PHASH_BUCKET(H_PHASH_HASH(0x0009e777u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 24 && H_PHASH_SLOT(H_PHASH_HASH(0x0009e777u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 207 ? 1 : -1];
+typedef char opcodes_phash_check_208[H_PHASH_BUCKET(H_PHASH_HASH(0x000f1d6au, OPCODES_SEED), OPCODES_BUCKET_BITS) == 29 && H_PHASH_SLOT(H_PHASH_HASH(0x000f1d6au, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 208 ? 1 : -1];
+typedef char opcodes_phash_check_209[H_PHASH_BUCKET(H_PHASH_HASH(0x000ae2ecu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 28 && H_PHASH_SLOT(H_PHASH_HASH(0x000ae2ecu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 209 ? 1 : -1];
+typedef char opcodes_phash_check_210[H_PHASH_BUCKET(H_PHASH_HASH(0x00065133u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x00065133u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 210 ? 1 : -1];
+typedef char opcodes_phash_check_212[H_PHASH_BUCKET(H_PHASH_HASH(0x000f9ebeu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 57 && H_PHASH_SLOT(H_PHASH_HASH(0x000f9ebeu, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 212 ? 1 : -1];
+typedef char opcodes_phash_check_213[H_PHASH_BUCKET(H_PHASH_HASH(0x000b1fefu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 32 && H_PHASH_SLOT(H_PHASH_HASH(0x000b1fefu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 213 ? 1 : -1];
+typedef char opcodes_phash_check_214[H_PHASH_BUCKET(H_PHASH_HASH(0x000fc892u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 6 && H_PHASH_SLOT(H_PHASH_HASH(0x000fc892u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 214 ? 1 : -1];
+typedef char opcodes_phash_check_215[H_PHASH_BUCKET(H_PHASH_HASH(0x000d0edbu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 47 && H_PHASH_SLOT(H_PHASH_HASH(0x000d0edbu, OPCODES_SEED), 14, OPCODES_SLOT_BITS) == 215 ? 1 : -1];
+typedef char opcodes_phash_check_216[H_PHASH_BUCKET(H_PHASH_HASH(0x0000f421u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 16 && H_PHASH_SLOT(H_PHASH_HASH(0x0000f421u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 216 ? 1 : -1];
+typedef char opcodes_phash_check_217[H_PHASH_BUCKET(H_PHASH_HASH(0x0004746au, OPCODES_SEED), OPCODES_BUCKET_BITS) == 50 && H_PHASH_SLOT(H_PHASH_HASH(0x0004746au, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 217 ? 1 : -1];
+typedef char opcodes_phash_check_218[H_PHASH_BUCKET(H_PHASH_HASH(0x0005affcu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x0005affcu, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 218 ? 1 : -1];
+typedef char opcodes_phash_check_219[H_PHASH_BUCKET(H_PHASH_HASH(0x00010130u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 11 && H_PHASH_SLOT(H_PHASH_HASH(0x00010130u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 219 ? 1 : -1];
+typedef char opcodes_phash_check_220[H_PHASH_BUCKET(H_PHASH_HASH(0x000e8e26u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 35 && H_PHASH_SLOT(H_PHASH_HASH(0x000e8e26u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 220 ? 1 : -1];
+typedef char opcodes_phash_check_221[H_PHASH_BUCKET(H_PHASH_HASH(0x00086735u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 55 && H_PHASH_SLOT(H_PHASH_HASH(0x00086735u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 221 ? 1 : -1];
+typedef char opcodes_phash_check_223[H_PHASH_BUCKET(H_PHASH_HASH(0x0002217cu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 59 && H_PHASH_SLOT(H_PHASH_HASH(0x0002217cu, OPCODES_SEED), 6, OPCODES_SLOT_BITS) == 223 ? 1 : -1];
+typedef char opcodes_phash_check_224[H_PHASH_BUCKET(H_PHASH_HASH(0x00072e6du, OPCODES_SEED), OPCODES_BUCKET_BITS) == 25 && H_PHASH_SLOT(H_PHASH_HASH(0x00072e6du, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 224 ? 1 : -1];
+typedef char opcodes_phash_check_225[H_PHASH_BUCKET(H_PHASH_HASH(0x00065dcau, OPCODES_SEED), OPCODES_BUCKET_BITS) == 55 && H_PHASH_SLOT(H_PHASH_HASH(0x00065dcau, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 225 ? 1 : -1];
+typedef char opcodes_phash_check_226[H_PHASH_BUCKET(H_PHASH_HASH(0x00081e75u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 30 && H_PHASH_SLOT(H_PHASH_HASH(0x00081e75u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 226 ? 1 : -1];
+typedef char opcodes_phash_check_227[H_PHASH_BUCKET(H_PHASH_HASH(0x0001a61eu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 52 && H_PHASH_SLOT(H_PHASH_HASH(0x0001a61eu, OPCODES_SEED), 19, OPCODES_SLOT_BITS) == 227 ? 1 : -1];
+typedef char opcodes_phash_check_228[H_PHASH_BUCKET(H_PHASH_HASH(0x0007ec00u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 4 && H_PHASH_SLOT(H_PHASH_HASH(0x0007ec00u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 228 ? 1 : -1];
+typedef char opcodes_phash_check_229[H_PHASH_BUCKET(H_PHASH_HASH(0x00049953u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 38 && H_PHASH_SLOT(H_PHASH_HASH(0x00049953u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 229 ? 1 : -1];
+typedef char opcodes_phash_check_230[H_PHASH_BUCKET(H_PHASH_HASH(0x000f28c2u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 8 && H_PHASH_SLOT(H_PHASH_HASH(0x000f28c2u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 230 ? 1 : -1];
+typedef char opcodes_phash_check_231[H_PHASH_BUCKET(H_PHASH_HASH(0x000c1d40u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 14 && H_PHASH_SLOT(H_PHASH_HASH(0x000c1d40u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 231 ? 1 : -1];
+typedef char opcodes_phash_check_232[H_PHASH_BUCKET(H_PHASH_HASH(0x0002b054u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 25 && H_PHASH_SLOT(H_PHASH_HASH(0x0002b054u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 232 ? 1 : -1];
+typedef char opcodes_phash_check_233[H_PHASH_BUCKET(H_PHASH_HASH(0x00049b65u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 2 && H_PHASH_SLOT(H_PHASH_HASH(0x00049b65u, OPCODES_SEED), 23, OPCODES_SLOT_BITS) == 233 ? 1 : -1];
+typedef char opcodes_phash_check_234[H_PHASH_BUCKET(H_PHASH_HASH(0x00026a2du, OPCODES_SEED), OPCODES_BUCKET_BITS) == 37 && H_PHASH_SLOT(H_PHASH_HASH(0x00026a2du, OPCODES_SEED), 14, OPCODES_SLOT_BITS) == 234 ? 1 : -1];
+typedef char opcodes_phash_check_235[H_PHASH_BUCKET(H_PHASH_HASH(0x0005f558u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 62 && H_PHASH_SLOT(H_PHASH_HASH(0x0005f558u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 235 ? 1 : -1];
+typedef char opcodes_phash_check_236[H_PHASH_BUCKET(H_PHASH_HASH(0x000153e8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 6 && H_PHASH_SLOT(H_PHASH_HASH(0x000153e8u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 236 ? 1 : -1];
+typedef char opcodes_phash_check_237[H_PHASH_BUCKET(H_PHASH_HASH(0x000907a8u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 12 && H_PHASH_SLOT(H_PHASH_HASH(0x000907a8u, OPCODES_SEED), 2, OPCODES_SLOT_BITS) == 237 ? 1 : -1];
+typedef char opcodes_phash_check_238[H_PHASH_BUCKET(H_PHASH_HASH(0x000e0091u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 32 && H_PHASH_SLOT(H_PHASH_HASH(0x000e0091u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 238 ? 1 : -1];
+typedef char opcodes_phash_check_241[H_PHASH_BUCKET(H_PHASH_HASH(0x0007e62bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 55 && H_PHASH_SLOT(H_PHASH_HASH(0x0007e62bu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 241 ? 1 : -1];
+typedef char opcodes_phash_check_242[H_PHASH_BUCKET(H_PHASH_HASH(0x0008a6a7u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 15 && H_PHASH_SLOT(H_PHASH_HASH(0x0008a6a7u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 242 ? 1 : -1];
+typedef char opcodes_phash_check_243[H_PHASH_BUCKET(H_PHASH_HASH(0x0003d9c2u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 31 && H_PHASH_SLOT(H_PHASH_HASH(0x0003d9c2u, OPCODES_SEED), 0, OPCODES_SLOT_BITS) == 243 ? 1 : -1];
+typedef char opcodes_phash_check_246[H_PHASH_BUCKET(H_PHASH_HASH(0x0009be4cu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 33 && H_PHASH_SLOT(H_PHASH_HASH(0x0009be4cu, OPCODES_SEED), 12, OPCODES_SLOT_BITS) == 246 ? 1 : -1];
+typedef char opcodes_phash_check_247[H_PHASH_BUCKET(H_PHASH_HASH(0x00017390u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 29 && H_PHASH_SLOT(H_PHASH_HASH(0x00017390u, OPCODES_SEED), 4, OPCODES_SLOT_BITS) == 247 ? 1 : -1];
+typedef char opcodes_phash_check_249[H_PHASH_BUCKET(H_PHASH_HASH(0x00014f48u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 37 && H_PHASH_SLOT(H_PHASH_HASH(0x00014f48u, OPCODES_SEED), 14, OPCODES_SLOT_BITS) == 249 ? 1 : -1];
+typedef char opcodes_phash_check_250[H_PHASH_BUCKET(H_PHASH_HASH(0x0002a970u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 47 && H_PHASH_SLOT(H_PHASH_HASH(0x0002a970u, OPCODES_SEED), 14, OPCODES_SLOT_BITS) == 250 ? 1 : -1];
+typedef char opcodes_phash_check_251[H_PHASH_BUCKET(H_PHASH_HASH(0x0008c390u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 36 && H_PHASH_SLOT(H_PHASH_HASH(0x0008c390u, OPCODES_SEED), 1, OPCODES_SLOT_BITS) == 251 ? 1 : -1];
+typedef char opcodes_phash_check_252[H_PHASH_BUCKET(H_PHASH_HASH(0x0004ef8bu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 2 && H_PHASH_SLOT(H_PHASH_HASH(0x0004ef8bu, OPCODES_SEED), 23, OPCODES_SLOT_BITS) == 252 ? 1 : -1];
+typedef char opcodes_phash_check_253[H_PHASH_BUCKET(H_PHASH_HASH(0x00013defu, OPCODES_SEED), OPCODES_BUCKET_BITS) == 24 && H_PHASH_SLOT(H_PHASH_HASH(0x00013defu, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 253 ? 1 : -1];
+typedef char opcodes_phash_check_255[H_PHASH_BUCKET(H_PHASH_HASH(0x000dd2e2u, OPCODES_SEED), OPCODES_BUCKET_BITS) == 51 && H_PHASH_SLOT(H_PHASH_HASH(0x000dd2e2u, OPCODES_SEED), 3, OPCODES_SLOT_BITS) == 255 ? 1 : -1];
+
+static inline opcodes_entry_t const *opcodes_find(uint32_t key) {
+    uint32_t hash = H_PHASH_HASH(key, OPCODES_SEED);
+    opcodes_entry_t const *entry = &opcodes_table[H_PHASH_SLOT(hash, opcodes_disp[H_PHASH_BUCKET(hash, OPCODES_BUCKET_BITS)], OPCODES_SLOT_BITS)];
+    return entry->used && entry->key == key ? entry : (opcodes_entry_t const*)0;
+}
+
+#endif
@@ -17,10 +17,15 @@
  *  H_ITER
  *  H_BITSET
  *  H_SMARTPTR
+ *  H_SKETCH
+ *  H_IO
  *
  *  Parameters :
  *
  *  H_DEBUG for debug messages related to allocators, collections etc...
+ *  H_TRACE to record trace zones and counters (hashmap, arena and array hot paths), see h_trace_save.
+ *          Costs ~50 ns per traced call, for profiling builds only
+ *  H_CACHE_LINE_SIZE to override the assumed cache line size (64 bytes by default)
  */
 
 #ifndef HCLIB_HCLIB_H
@@ -42,6 +47,10 @@
 #define H_CASSERT(predicate, file)
 #endif
 
+#ifndef H_CACHE_LINE_SIZE
+#define H_CACHE_LINE_SIZE 64
+#endif
+
 #define _impl_H_PASTE(a,b) a##b
 #define _impl_H_CASSERT_LINE(predicate, line, file) \
 typedef char _impl_H_PASTE(assertion_failed_##file##_,line)[2*!!(predicate)-1];
@@ -57,12 +66,28 @@ typedef char _impl_H_PASTE(assertion_failed_##file##_,line)[2*!!(predicate)-1];
 #define H_ITER
 #define H_BITSET
 #define H_SMARTPTR
+#define H_SKETCH
+#define H_IO
 #endif
 
 //
 // Dependencies
 //
 
+#ifdef H_IO
+#define H_STRING
+#endif
+
+#ifdef H_TRACE
+#define H_TYPES
+#endif
+
+#ifdef H_SKETCH
+#define H_TYPES
+#define H_HASH
+#define H_BITSET
+#endif
+
 #ifdef H_BITSET
 #define H_TYPES
 #endif
@@ -72,12 +97,48 @@ typedef char _impl_H_PASTE(assertion_failed_##file##_,line)[2*!!(predicate)-1];
 #define H_HASH
 #endif
 
+#ifdef H_STRING
+#define H_TYPES
+#define H_COLLECTIONS
+#define H_HASH
+#endif
+
+#ifdef H_COLLECTIONS
+#define H_TYPES
+#define H_ALLOCATORS
+#endif
+
 #ifdef H_HASH
 #ifdef H_COLLECTIONS
 #define H_ALLOCATORS
 #endif
 #endif
 
+#if ((defined(H_SKETCH) || defined(H_RANDOM) || defined(H_STRING) || defined(H_COLLECTIONS)) && defined(__AVX2__)) \
+    || (defined(H_STRING) && defined(__SSE4_2__))
+#include <immintrin.h>
+#endif
+
+#ifdef H_STRING
+#include <pthread.h>
+#endif
+
+#ifdef H_TRACE
+#include <pthread.h>
+#include <time.h>
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(H_TRACE_CLOCK_GETTIME)
+#include <x86intrin.h>
+#endif
+#endif
+
+#ifdef H_IO
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 //
 //  DECLARATIONS
 //
@@ -120,6 +181,7 @@ typedef struct h_arena_t {
     void **blocks;
     void **current;
     void *end;
+    void *limit;
 
 #ifdef H_DEBUG
     char const* debug_name;
@@ -180,12 +242,159 @@ void *h_dequeue(h_queue_t *queue);
 #define H_DEQUEUE(type, queue) ({type *_vp=(type*)h_dequeue((h_queue_t*)&(queue));type _v = *_vp;free(_vp);_v;})
 void h_queue_free(h_queue_t *queue);
 
+// Slot map
+// Values live packed in a dense array (map.values[0..size)) for tight iteration. They are reached
+// through handles, a slot index plus the slot's generation, which stay valid until that value is
+// erased, whatever else is inserted or erased. A stale handle fails the generation check.
+// Erasing moves the last value into the hole, so raw value pointers and dense positions are
+// only valid until the next insert or erase. The zeroed handle H_NULL_HANDLE is never valid.
+
+typedef struct h_handle_t {
+    u32 index;
+    u32 generation;
+} h_handle_t;
+
+#define H_NULL_HANDLE ((h_handle_t){0, 0})
+
+typedef struct _impl_h_slot_t {
+    u32 dense;          // dense position when live, next free slot otherwise
+    u32 generation;
+} _impl_h_slot_t;
+
+typedef struct h_slot_map_t {
+    u32 size;
+    u32 cap;
+    size_t el_size;
+    void *values;
+    u32 *dense_slots;   // slot owning each dense value
+
+    _impl_h_slot_t *slots;
+    u32 nslots;
+    u32 free_head;
+} h_slot_map_t;
+
+h_slot_map_t h_create_slot_map(size_t el_size, u32 cap);
+#define H_CREATE_SLOT_MAP(type, cap) h_create_slot_map(sizeof(type), (cap))
+
+h_handle_t h_slot_map_insert(h_slot_map_t *map, void const *val);
+#define H_SLOT_MAP_INSERT(type, map, val) ({type _v=(val); h_slot_map_insert(&(map), &_v);})
+void *h_slot_map_get(h_slot_map_t const *map, h_handle_t handle);
+#define H_SLOT_MAP_GET(type, map, handle) ((type*)h_slot_map_get(&(map), (handle)))
+bool h_slot_map_contains(h_slot_map_t const *map, h_handle_t handle);
+bool h_slot_map_erase(h_slot_map_t *map, h_handle_t handle);
+h_handle_t h_slot_map_handle_at(h_slot_map_t const *map, u32 dense);
+void h_slot_map_clear(h_slot_map_t *map);
+void h_slot_map_free(h_slot_map_t *map);
+
+// Sparse set
+// Integer ids below a universe that grows on demand, with O(1) insert, erase and membership.
+// The ids present are packed in set.dense[0..size), each with an optional el_size value in
+// set.values at the same position. Erasing moves the last id into the hole.
+
+typedef struct h_sparse_set_t {
+    u32 size;
+    u32 cap;
+    u32 *dense;
+    void *values;
+    size_t el_size;
+
+    u32 *sparse;
+    u32 universe;
+} h_sparse_set_t;
+
+h_sparse_set_t h_create_sparse_set(size_t el_size, u32 universe);
+bool h_sparse_set_insert(h_sparse_set_t *set, u32 id, void const *val);
+bool h_sparse_set_contains(h_sparse_set_t const *set, u32 id);
+void *h_sparse_set_get(h_sparse_set_t const *set, u32 id);
+bool h_sparse_set_erase(h_sparse_set_t *set, u32 id);
+void h_sparse_set_clear(h_sparse_set_t *set);
+void h_sparse_set_free(h_sparse_set_t *set);
+
+// B+tree ordered map
+// Pairs of pair_size bytes, ordered by a three-way comparator (<0, 0, >0 as key is below, equal
+// to or above the pair's key) or by an integer key stored at the start of each pair. Integer
+// trees keep a packed copy of the keys in every node and search it with AVX2 when available.
+// Nodes are H_BTREE_NODE_SIZE bytes, cache line aligned, carved from an arena and released
+// together by h_btree_free. Leaves are linked for range scans.
+// Pair pointers are only valid until the next put, remove or bulk load. Remove doesn't rebalance,
+// leaves may run underfull until the tree is rebuilt.
+
+#ifndef H_BTREE_NODE_SIZE
+#define H_BTREE_NODE_SIZE (8 * H_CACHE_LINE_SIZE)
+#endif
+
+typedef int (h_korder_fn_t)(void const *key, void const *pair);
+
+typedef enum h_btree_key_t {
+    H_BTREE_KEY_CUSTOM,
+    H_BTREE_KEY_U32,
+    H_BTREE_KEY_I32,
+    H_BTREE_KEY_U64,
+    H_BTREE_KEY_I64
+} h_btree_key_t;
+
+typedef struct h_btree_node_t {
+    u32 count;
+    u32 leaf;
+    struct h_btree_node_t *next;    // next leaf, leaves only
+} h_btree_node_t;
+
+typedef struct h_btree_t {
+    size_t pair_size;
+    h_btree_key_t key_kind;
+    h_korder_fn_t *order_fn;
+    size_t size;
+
+    h_btree_node_t *root;
+    h_btree_node_t *first;
+    u32 height;
+
+    // node layout, keys follow the header in both kinds of node
+    size_t node_size;
+    size_t key_size;
+    u32 leaf_cap;
+    u32 inner_cap;
+    size_t leaf_pairs;
+    size_t inner_children;
+
+    h_arena_t *arena;
+    char *scratch;      // two separators in node format, for splits
+    char *slab;
+    char *slab_end;
+    size_t slab_nodes;
+} h_btree_t;
+
+typedef struct h_btree_cursor_t {
+    h_btree_t const *tree;
+    h_btree_node_t const *leaf;
+    u32 idx;
+    void const *hi;
+} h_btree_cursor_t;
+
+h_btree_t h_create_btree(size_t pair_size, h_korder_fn_t *order_fn);
+h_btree_t h_create_btree_int(size_t pair_size, h_btree_key_t key_kind);
+#define H_CREATE_BTREE(ptype, orderfn) h_create_btree(sizeof(ptype), (orderfn))
+#define H_CREATE_BTREE_INT(ptype, kind) h_create_btree_int(sizeof(ptype), (kind))
+
+void *h_btree_put(h_btree_t *tree, void const *pair);
+void *h_btree_get(h_btree_t const *tree, void const *key);
+#define H_BTREE_GET(tree, key) ({typeof(key) _k##__LINE__ = key;h_btree_get(&(tree), &(_k##__LINE__));})
+bool h_btree_remove(h_btree_t *tree, void const *key);
+// The tree must be empty and the array's pairs strictly ascending, fails otherwise
+bool h_btree_bulk_load(h_btree_t *tree, h_array_t const *sorted);
+// First pair whose key is not below key, NULL past the end
+void *h_btree_lower_bound(h_btree_t const *tree, void const *key);
+// Walks pairs in [lo, hi), a NULL bound is open
+h_btree_cursor_t h_btree_range(h_btree_t const *tree, void const *lo, void const *hi);
+void *h_btree_next(h_btree_cursor_t *cursor);
+void h_btree_free(h_btree_t *tree);
+
 #endif
 
 #ifdef H_HASH
 
 #define _impl_H_STATIC_PCG_HASH_STATE(Seed) ((u32)(Seed) * 747796405u + 2891336453u)
-#define _impl_H_STATIC_PCG_HASH_WORD(Seed) ((_impl_H_STATIC_PCG_HASH_STATE(Seed)>>((_impl_H_STATIC_PCG_HASH_STATE(Seed)>>28)+4)*277803737u))
+#define _impl_H_STATIC_PCG_HASH_WORD(Seed) (((_impl_H_STATIC_PCG_HASH_STATE(Seed)>>((_impl_H_STATIC_PCG_HASH_STATE(Seed)>>28)+4)) ^ _impl_H_STATIC_PCG_HASH_STATE(Seed))*277803737u)
 #define H_STATIC_PCG_HASH(Seed) ((_impl_H_STATIC_PCG_HASH_WORD(Seed) >> 22u) ^ _impl_H_STATIC_PCG_HASH_WORD(Seed))
 
     typedef u32 (h_hash_fn_t)(u32);
@@ -194,6 +403,46 @@ void h_queue_free(h_queue_t *queue);
 
     u32 h_hash(h_hash_fn_t *hash_fn, void *val, size_t size);
 
+    // Word at a time hash of a byte range, much cheaper than h_hash on long keys
+    u32 h_hash_bytes(void const *data, size_t size);
+    // Same walk with a full 64 bit finalizer, for users needing two independent 32 bit halves
+    u64 h_hash_bytes64(void const *data, size_t size);
+
+    // Perfect hashing of fixed key sets (hash and displace)
+    // A key's seeded hash picks a bucket from the top bits of its low half, and the bucket's
+    // displacement rehashes both halves into a slot. Integer keys hash to 32 bits through a bijection,
+    // so they never collide. Byte keys hash to 64 bits, since 32 bits collide past ~100k keys. The builder searches displacements, largest buckets first, until
+    // every key owns a slot, so a lookup is one displacement read, one probe and one compare.
+    // Sizes are powers of two, about 1.25 slots and 0.25 buckets per key.
+    // The macros are integer constant expressions for constant arguments, tools/phash_gen.c
+    // emits C/C++ tables whose integer key placement the compiler checks with them.
+
+#define H_PHASH_HASH(key, seed) H_STATIC_PCG_HASH((uint32_t)(key) ^ (uint32_t)(seed))
+#define H_PHASH_BUCKET(hash, bucket_bits) ((bucket_bits) ? (uint32_t)(hash) >> (32 - (bucket_bits)) : 0u)
+#define H_PHASH_SLOT(hash, disp, slot_bits) \
+    (H_STATIC_PCG_HASH((uint32_t)(hash) ^ (uint32_t)((uint64_t)(hash) >> 32) ^ ((uint32_t)(disp) * 0x9e3779b9u)) & ((1u << (slot_bits)) - 1u))
+#define H_PHASH_EMPTY UINT32_MAX
+
+    typedef struct h_phash_t {
+        u32 seed;
+        u32 nkeys;
+        u32 bucket_bits;
+        u32 slot_bits;
+        u16 *disp;
+        u32 *slots;     // key index owning each slot, H_PHASH_EMPTY if none
+    } h_phash_t;
+
+    u64 h_phash_hash_bytes(void const *data, size_t size, u32 seed);
+
+    // Both fail (slots NULL) on duplicate keys. Distinct keys only fail when each of 64 seeds gives
+    // a 64 bit hash collision or a bucket needing a displacement past 65536, not seen in practice
+    h_phash_t h_create_phash_u32(u32 const *keys, u32 nkeys);
+    h_phash_t h_create_phash_bytes(void const *const *keys, size_t const *sizes, u32 nkeys);
+
+    // Index of the only key that can have this hash, to be compared by the caller
+    u32 h_phash_lookup(h_phash_t const *phash, u64 hash);
+    void h_phash_free(h_phash_t *phash);
+
 #ifdef H_COLLECTIONS
 
     typedef u32 (h_kvpair_hash_fn_t)(void*);
@@ -248,6 +497,66 @@ void h_queue_free(h_queue_t *queue);
 
     i32 h_randi(u32 seed, i32 min, i32 max);
 
+    // Stateful generator (xoshiro256**)
+    // Seeded through splitmix64, so any seed including 0 gives a valid state.
+
+    typedef struct h_rng_t {
+        u64 s[4];
+    } h_rng_t;
+
+    h_rng_t h_create_rng(u64 seed);
+
+    u64 h_rng_next_u64(h_rng_t *rng);
+    u32 h_rng_next_u32(h_rng_t *rng);
+    f32 h_rng_next_f32(h_rng_t *rng);
+    f64 h_rng_next_f64(h_rng_t *rng);
+
+    u32 h_rng_bounded_u32(h_rng_t *rng, u32 bound);
+    u64 h_rng_bounded_u64(h_rng_t *rng, u64 bound);
+    i32 h_rng_range_i32(h_rng_t *rng, i32 min, i32 max);
+
+    // Bulk fills run H_RNG_LANES interleaved generators seeded from rng (AVX2 when available).
+    // The output is deterministic for a given rng state and n, but differs from n calls to next.
+
+#define H_RNG_LANES 8
+
+    void h_rng_fill_u32(h_rng_t *rng, u32 *out, size_t n);
+    void h_rng_fill_u64(h_rng_t *rng, u64 *out, size_t n);
+    void h_rng_fill_f32(h_rng_t *rng, f32 *out, size_t n);
+
+    // Substreams
+    // h_rng_jump advances by 2^128 steps, h_rng_long_jump by 2^192. Handing worker i the
+    // i-th jump of a master generator gives non-overlapping streams that don't depend on
+    // how many workers run, or in which order they start.
+
+    void h_rng_jump(h_rng_t *rng);
+    void h_rng_long_jump(h_rng_t *rng);
+    h_rng_t h_rng_substream(h_rng_t const *master, size_t idx);
+    void h_rng_split(h_rng_t *master, h_rng_t *streams, size_t n);
+
+    // Distributions
+
+    f64 h_rng_normal(h_rng_t *rng, f64 mean, f64 stddev);
+    f64 h_rng_exponential(h_rng_t *rng, f64 rate);
+    u32 h_rng_poisson(h_rng_t *rng, f64 lambda);
+
+    void h_rng_fill_normal(h_rng_t *rng, f64 *out, size_t n, f64 mean, f64 stddev);
+    void h_rng_fill_exponential(h_rng_t *rng, f64 *out, size_t n, f64 rate);
+    void h_rng_fill_poisson(h_rng_t *rng, u32 *out, size_t n, f64 lambda);
+
+    // Weighted discrete choice in O(1) per sample (Vose's alias method)
+
+    typedef struct h_alias_table_t {
+        size_t n;
+        f64 *prob;
+        u32 *alias;
+    } h_alias_table_t;
+
+    h_alias_table_t h_create_alias_table(f64 const *weights, size_t n);
+    u32 h_alias_sample(h_alias_table_t const *table, h_rng_t *rng);
+    void h_alias_fill(h_alias_table_t const *table, h_rng_t *rng, u32 *out, size_t n);
+    void h_alias_table_free(h_alias_table_t *table);
+
 #endif
 
 #ifdef H_STRING
@@ -266,7 +575,184 @@ void h_queue_free(h_queue_t *queue);
 
     bool h_string_eq_ptr(void* a, void* b);
 
+    // String views
+    // Pointer + length into a buffer owned by someone else, no NUL terminator required.
+
+    typedef struct h_string_view_t {
+        char const *data;
+        size_t size;
+    } h_string_view_t;
+
+    h_string_view_t h_string_view(h_string_t str);
+    h_string_view_t h_string_view_cstr(char const *cstr);
+    h_string_view_t h_string_view_sub(h_string_view_t view, size_t offset, size_t size);
+    bool h_string_view_eq(h_string_view_t a, h_string_view_t b);
+    h_string_t h_string_view_dup(h_string_view_t view);
+
+    // Splits into views of the original buffer, keeping empty fields ("a,,b" gives 3 fields).
+    // The array is allocated once, the iterator form allocates nothing.
+    h_array_t h_split_view(h_string_view_t str, char delim);
+
+    typedef struct h_split_iter_t {
+        char const *pos;
+        char const *end;
+        char delim;
+        bool done;
+        h_string_view_t current;
+    } h_split_iter_t;
+
+    h_split_iter_t h_split_iter(h_string_view_t str, char delim);
+    bool h_split_next(h_split_iter_t *split, h_string_view_t *out);
+
+    // Fills out with up to max fields of a record, returns how many were written.
+    // Delimiters are located 32 bytes at a time with AVX2, memchr otherwise.
+    size_t h_split_fields(h_string_view_t record, char delim, h_string_view_t *out, size_t max);
+
+    // Search, classification and validation kernels
+    // AVX2 (and SSE4.2 for find_any) when the target allows it, portable scalar code otherwise.
+    // Searches return a byte offset or H_STRING_NPOS. Casing is ASCII only and locale independent.
+
+#define H_STRING_NPOS ((size_t)-1)
+
+    size_t h_string_find(h_string_view_t haystack, h_string_view_t needle);
+    size_t h_string_find_any(h_string_view_t str, h_string_view_t set);
+    size_t h_string_count_char(h_string_view_t str, char c);
+    void h_string_to_lower(h_string_t str);
+    void h_string_to_upper(h_string_t str);
+    int h_string_casecmp(h_string_view_t a, h_string_view_t b);
+    bool h_utf8_validate(h_string_view_t str);
+
 #ifdef H_ALLOCATORS
+
+    // String interning
+    // Maps each distinct string to a dense u32 id (0, 1, 2...) so equality is an integer compare.
+    // Bytes are copied once, NUL terminated, into an arena and never move, so looked up views stay valid.
+    // h_intern (and h_shared_intern) return H_INTERN_FAILED when memory runs out, the interner is then
+    // left as it was. h_create_interner returns a zeroed interner (arena NULL) when it can't allocate,
+    // on which h_intern fails and lookups find nothing, and h_shared_interner_create returns NULL.
+
+#define H_INTERN_FAILED UINT32_MAX
+
+    typedef struct h_intern_entry_t {
+        char const *data;
+        u32 size;
+        u32 hash;
+    } h_intern_entry_t;
+
+    typedef struct h_interner_t {
+        h_arena_t *arena;
+        size_t string_bytes;
+        h_array_t entries;
+        u32 *slots;
+        size_t nslots;
+    } h_interner_t;
+
+    h_interner_t h_create_interner(size_t expected);
+    u32 h_intern(h_interner_t *interner, h_string_view_t str);
+    bool h_interner_find(h_interner_t const *interner, h_string_view_t str, u32 *out_id);
+    h_string_view_t h_interner_lookup(h_interner_t const *interner, u32 id);
+    u32 h_interner_hash(h_interner_t const *interner, u32 id);
+    size_t h_interner_count(h_interner_t const *interner);
+    size_t h_interner_memory(h_interner_t const *interner);  // bytes held by strings and tables
+    void h_interner_free(h_interner_t *interner);
+
+    // hashmap callbacks for pairs starting with a u32 symbol id
+    u32 h_symbol_hash_ptr(void *pair);
+    bool h_symbol_eq_ptr(void *a, void *b);
+
+    // Shared interner, readers take a read lock and only first sightings take the write lock
+
+    typedef struct h_shared_interner_t {
+        h_interner_t interner;
+        pthread_rwlock_t lock;
+    } h_shared_interner_t;
+
+    h_shared_interner_t *h_shared_interner_create(size_t expected);
+    u32 h_shared_intern(h_shared_interner_t *shared, h_string_view_t str);
+    bool h_shared_interner_find(h_shared_interner_t *shared, h_string_view_t str, u32 *out_id);
+    h_string_view_t h_shared_interner_lookup(h_shared_interner_t *shared, u32 id);
+    void h_shared_interner_destroy(h_shared_interner_t *shared);
+
+    // Small string optimized string
+    // 24 bytes. Up to H_SSO_CAPACITY bytes live inline, with the last byte holding the unused
+    // inline capacity, so a full 23 byte string ends on its own NUL terminator. Longer strings
+    // spill to the heap or an arena, and the last byte then carries the large/owned flags.
+    // The inline bytes past the string are zeroed, so two inline strings compare as three words.
+    // When the spill allocation fails the result is a large string with NULL data, which h_sso_ok
+    // reports : it is empty, equal to no string (itself included) and safe to free.
+
+#define H_SSO_CAPACITY 23
+#define _impl_H_SSO_LARGE 0x80
+#define _impl_H_SSO_OWNED 0x40
+
+    typedef union h_sso_string_t {
+        char small[H_SSO_CAPACITY + 1];
+        struct {
+            char *data;
+            size_t size;
+            size_t tag;
+        } large;
+    } h_sso_string_t;
+
+    H_CASSERT(sizeof(h_sso_string_t) == 24, h_sso_string_t)
+
+    h_sso_string_t h_sso_from_view(h_string_view_t str);
+    h_sso_string_t h_sso_from_view_arena(h_arena_t *arena, h_string_view_t str);
+    h_sso_string_t h_sso_from_string(h_string_t str);
+    bool h_sso_ok(h_sso_string_t const *str);
+    h_string_view_t h_sso_view(h_sso_string_t const *str);
+    h_string_t h_sso_to_string(h_sso_string_t *str);  // borrows the bytes, valid while str is
+    char const *h_sso_cstr(h_sso_string_t const *str);
+    size_t h_sso_size(h_sso_string_t const *str);
+    bool h_sso_is_inline(h_sso_string_t const *str);
+    bool h_sso_eq(h_sso_string_t const *a, h_sso_string_t const *b);
+    u32 h_sso_hash(h_sso_string_t const *str);
+    void h_sso_free(h_sso_string_t *str);
+
+    // hashmap callbacks for pairs starting with a h_sso_string_t key
+    u32 h_sso_hash_ptr(void *pair);
+    bool h_sso_eq_ptr(void *a, void *b);
+
+    // String builder
+    // Appends grow the buffer geometrically. Arena and linear allocator backed builders grow in place
+    // while they own the last allocation, and otherwise move to a fresh region (the old one stays in the allocator).
+    // Appends return false when the backing allocator runs out, leaving the builder unchanged.
+
+    typedef enum h_string_builder_backing_t {
+        H_STRING_BUILDER_HEAP,
+        H_STRING_BUILDER_ARENA,
+        H_STRING_BUILDER_LINEAR,
+    } h_string_builder_backing_t;
+
+    typedef struct h_string_builder_t {
+        char *data;
+        size_t size;
+        size_t cap;
+        h_string_builder_backing_t backing;
+        void *allocator;
+    } h_string_builder_t;
+
+    h_string_builder_t h_create_string_builder(size_t cap);
+    h_string_builder_t h_create_arena_string_builder(h_arena_t *arena, size_t cap);
+    h_string_builder_t h_create_linear_string_builder(h_linear_allocator_t *allocator, size_t cap);
+
+    bool h_string_builder_reserve(h_string_builder_t *sb, size_t extra);
+    bool h_string_builder_append(h_string_builder_t *sb, h_string_view_t str);
+    bool h_string_builder_append_cstr(h_string_builder_t *sb, char const *cstr);
+    bool h_string_builder_append_char(h_string_builder_t *sb, char c);
+    bool h_string_builder_append_i64(h_string_builder_t *sb, i64 val);
+    bool h_string_builder_append_u64(h_string_builder_t *sb, u64 val);
+    // Same digits as %.*f, rounded half to even from the exact binary value. Up to 9 decimals below 1e18
+    // are formatted inline, larger values or more decimals go through snprintf. nan has no sign.
+    bool h_string_builder_append_f64(h_string_builder_t *sb, f64 val, u32 decimals);
+
+    h_string_view_t h_string_builder_view(h_string_builder_t const *sb);
+    void h_string_builder_clear(h_string_builder_t *sb);
+    // NUL terminates and hands the buffer over without copying, the builder is left empty.
+    // Heap backed strings are released with free, the others belong to their allocator.
+    h_string_t h_string_builder_finish(h_string_builder_t *sb);
+    void h_string_builder_free(h_string_builder_t *sb);
+
     h_string_t h_arena_string_alloc_cstr(h_linear_allocator_t *arena, char *cstr);
     h_string_t h_arena_string_alloc_size(h_linear_allocator_t *arena, size_t size);
 #define h_arena_string_alloc(arena, p) _Generic( p,\
@@ -307,6 +793,179 @@ size_t : h_arena_string_alloc_size\
     void h_bitset_and(h_bitset_t *bitset, h_bitset_t *other);
     void h_bitset_xor(h_bitset_t *bitset, h_bitset_t *other);
 
+    // Atomic Bitset
+    // Fixed capacity, safe to set/clear/claim from several threads without a lock.
+    // Words are allocated on cache line boundaries so threads working on different
+    // lines (see h_atomic_bitset_thread_hint) don't false share.
+
+#define _impl_H_BITSET_WORD_BITS (sizeof(h_bitset_word_t) * 8)
+#define _impl_H_ATOMIC_BITSET_LINE_WORDS (H_CACHE_LINE_SIZE / sizeof(h_bitset_word_t))
+
+    typedef struct h_atomic_bitset_t {
+        size_t nbits;
+        size_t nwords;
+        h_bitset_word_t *words;
+    } h_atomic_bitset_t;
+
+    h_atomic_bitset_t h_create_atomic_bitset(size_t nbits);
+
+    // test_and_set returns the previous bit, false meaning the caller now owns idx, clear returns
+    // whether it released a set bit. Indices past nbits read as permanently set, like the padding :
+    // test and test_and_set return true, clear returns false and changes nothing. H_DEBUG exits on them.
+    bool h_atomic_bitset_test(h_atomic_bitset_t *bitset, size_t idx);
+    bool h_atomic_bitset_test_and_set(h_atomic_bitset_t *bitset, size_t idx);
+    bool h_atomic_bitset_clear(h_atomic_bitset_t *bitset, size_t idx);
+    // Word by word, not atomic as a whole, but claim never sees an index past nbits meanwhile
+    void h_atomic_bitset_clear_all(h_atomic_bitset_t *bitset);
+    bool h_atomic_bitset_claim(h_atomic_bitset_t *bitset, size_t *hint, size_t *out_idx);
+    size_t h_atomic_bitset_thread_hint(h_atomic_bitset_t const *bitset, size_t thread_idx, size_t nthreads);
+    void h_atomic_bitset_free(h_atomic_bitset_t *bitset);
+
+#endif
+
+#ifdef H_SKETCH
+
+    // Blocked Bloom filter
+    // Every key maps to one cache line sized block and sets one bit in each of its 8 words,
+    // so a query touches a single line (checked with AVX2 when available).
+    // Keys are given either as bytes (hashed with h_hash_bytes64) or as a precomputed 64 bit hash
+    // whose high half picks the block and low half the bits, so both halves must be well mixed.
+    // The block count comes from the blocked filter's own false positive rate (Poisson block loads),
+    // so measured rates land at or just under fp_rate for any number of keys.
+
+#define H_BLOOM_BLOCK_WORDS 8
+
+    typedef struct h_bloom_t {
+        size_t nblocks;
+        h_bitset_t bits;
+    } h_bloom_t;
+
+    h_bloom_t h_create_bloom(size_t expected_keys, double fp_rate);
+
+    void h_bloom_insert_hash(h_bloom_t *bloom, u64 hash);
+    bool h_bloom_query_hash(h_bloom_t const *bloom, u64 hash);
+    void h_bloom_insert(h_bloom_t *bloom, void *key, size_t size);
+    bool h_bloom_query(h_bloom_t const *bloom, void *key, size_t size);
+
+    void h_bloom_insert_batch(h_bloom_t *bloom, u64 const *hashes, size_t n);
+    size_t h_bloom_query_batch(h_bloom_t const *bloom, u64 const *hashes, size_t n, bool *out);
+
+    bool h_bloom_merge(h_bloom_t *bloom, h_bloom_t *other);
+    void h_bloom_clear(h_bloom_t *bloom);
+    void h_bloom_free(h_bloom_t *bloom);
+
+    // Count-min sketch
+    // Estimates never undercount, and overcount by at most epsilon * total with probability 1 - delta.
+
+    typedef struct h_count_min_t {
+        size_t width;
+        size_t depth;
+        u32 *counters;
+    } h_count_min_t;
+
+    h_count_min_t h_create_count_min(double epsilon, double delta);
+
+    void h_count_min_add_hash(h_count_min_t *sketch, u32 hash, u32 count);
+    u32 h_count_min_estimate_hash(h_count_min_t const *sketch, u32 hash);
+    void h_count_min_add(h_count_min_t *sketch, void *key, size_t size, u32 count);
+    u32 h_count_min_estimate(h_count_min_t const *sketch, void *key, size_t size);
+
+    void h_count_min_add_batch(h_count_min_t *sketch, u32 const *hashes, size_t n);
+    void h_count_min_estimate_batch(h_count_min_t const *sketch, u32 const *hashes, size_t n, u32 *out);
+
+    bool h_count_min_merge(h_count_min_t *sketch, h_count_min_t const *other);
+    void h_count_min_clear(h_count_min_t *sketch);
+    void h_count_min_free(h_count_min_t *sketch);
+
+#endif
+
+#ifdef H_IO
+
+    // Streaming record reader
+    // Regular files are mmap'ed whole (with a sequential access hint) and records are views into
+    // the mapping, valid until the reader is closed. Pipes, sockets, or files that can't be mapped
+    // are read in chunks, and records are then views into the reader's buffer, valid until the next
+    // call to h_file_reader_next. A record crossing a chunk boundary is moved to the front of the
+    // buffer, which grows if a single record doesn't fit.
+    // The delimiter is not part of the record, and a missing final delimiter still ends a record.
+
+#define H_FILE_READER_CHUNK_SIZE (1 << 20)
+
+    typedef struct h_file_reader_t {
+        int fd;
+        bool owns_fd;
+        bool mapped;
+        bool eof;
+        char delim;
+
+        char *data;
+        size_t size;
+        size_t pos;
+        size_t cap;
+    } h_file_reader_t;
+
+    h_file_reader_t h_file_reader_open(char const *path, char delim);
+    h_file_reader_t h_file_reader_from_fd(int fd, char delim);
+    bool h_file_reader_ok(h_file_reader_t const *reader);
+    bool h_file_reader_next(h_file_reader_t *reader, h_string_view_t *record);
+    void h_file_reader_close(h_file_reader_t *reader);
+
+    // Snapshots
+    // An h_array_t or h_hashmap_t is written as a header followed by its raw pools, each section
+    // aligned to H_CACHE_LINE_SIZE. h_snapshot_open maps the file read-only and the collections
+    // returned by h_snapshot_array/h_snapshot_hashmap point straight into the mapping, so a lookup
+    // table is usable once the header and indices check out, the pairs paging in on first touch.
+    // Those collections are read-only : never put, remove, set, clear or free them, close the
+    // snapshot instead.
+    // The hashmap's hash and compare functions aren't stored and must be given again at load. They
+    // have to be the ones the map was built with, a mismatch on the first pair's hash is rejected.
+    // Both return a zeroed collection (data/buckets NULL) when the snapshot holds something else.
+    // The header is always checksummed, and a hashmap's bucket and chain indices always checked to
+    // reach every pair exactly once, so lookups on a torn or corrupted file stay inside the mapping
+    // and terminate. That reads the index sections only, the payload checksum reads the whole file
+    // and is only verified when verify is set. Files from a different version, byte order or word
+    // size are rejected. Saves are synced to disk before the rename, then the directory is synced.
+
+#define H_SNAPSHOT_VERSION 1
+
+    typedef enum h_snapshot_kind_t {
+        H_SNAPSHOT_NONE,
+        H_SNAPSHOT_ARRAY,
+        H_SNAPSHOT_HASHMAP
+    } h_snapshot_kind_t;
+
+    typedef struct h_snapshot_header_t {
+        char magic[8];
+        u32 version;
+        u32 kind;
+        u32 byte_order;
+        u32 word_size;
+        u64 el_size;
+        u64 count;
+        u64 nbuckets;
+        u64 hash_probe;
+        u64 sections[3];
+        u64 section_sizes[3];
+        u64 file_size;
+        u64 payload_checksum;
+        u64 header_checksum;
+    } h_snapshot_header_t;
+
+    typedef struct h_snapshot_t {
+        h_snapshot_header_t const *header;
+        size_t size;
+    } h_snapshot_t;
+
+    bool h_array_save(h_array_t const *arr, char const *path);
+    bool h_hashmap_save(h_hashmap_t const *hashmap, char const *path);
+
+    h_snapshot_t h_snapshot_open(char const *path, bool verify);
+    bool h_snapshot_ok(h_snapshot_t const *snapshot);
+    h_snapshot_kind_t h_snapshot_kind(h_snapshot_t const *snapshot);
+    h_array_t h_snapshot_array(h_snapshot_t const *snapshot);
+    h_hashmap_t h_snapshot_hashmap(h_snapshot_t const *snapshot, h_kvpair_hash_fn_t *hash_fn, h_kcompare_fn_t *kcompare_fn);
+    void h_snapshot_close(h_snapshot_t *snapshot);
+
 #endif
 
 #ifdef H_ITER
@@ -330,6 +989,14 @@ size_t : h_arena_string_alloc_size\
     void *h_queue_next(h_iter_t *iter);
     bool h_queue_hasnext(h_iter_t *iter);
 
+    h_iter_t h_slot_map_iter(h_slot_map_t *map);
+    void *h_slot_map_next(h_iter_t *iter);
+    bool h_slot_map_hasnext(h_iter_t *iter);
+
+    h_iter_t h_sparse_set_iter(h_sparse_set_t *set);
+    void *h_sparse_set_next(h_iter_t *iter);
+    bool h_sparse_set_hasnext(h_iter_t *iter);
+
 #endif
 
 #ifdef H_BITSET
@@ -338,6 +1005,12 @@ size_t : h_arena_string_alloc_size\
     bool h_bitset_hasnext(h_iter_t *iter);
 #endif
 
+#ifdef H_STRING
+    h_iter_t h_split_view_iter(h_split_iter_t *split);
+    void *h_split_view_next(h_iter_t *iter);
+    bool h_split_view_hasnext(h_iter_t *iter);
+#endif
+
 #define H_FOREACH(type, name, iter) \
     for(;iter.hasnext(&(iter));)\
         for(type name = *(type*)iter.next(&(iter)),*_once=&name; _once; _once=NULL)
@@ -363,6 +1036,92 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
 
 #endif
 
+#ifdef H_TRACE
+
+    // Trace zones
+    // A zone records its name, start and duration into a ring buffer owned by the calling thread,
+    // allocated on its first event. Writing one is two timestamps, a 32 byte store and a release
+    // store of the ring head, no lock or shared cache line. Counters record a named value the same way.
+    // A full ring overwrites its oldest events. h_trace_write/h_trace_save drain every thread's ring
+    // into Chrome trace JSON (chrome://tracing, ui.perfetto.dev) without stopping the writers,
+    // events overwritten while being read are dropped and counted.
+    // Timestamps are rdtsc ticks on x86 (an invariant TSC is assumed, define H_TRACE_CLOCK_GETTIME
+    // to use CLOCK_MONOTONIC instead) converted to microseconds at flush.
+    // Rings (H_TRACE_BUFFER_EVENTS * 32 bytes, 2 MB by default) are never freed : a thread's ring is
+    // retired when it exits and handed to the next thread that attaches, so memory is bounded by the
+    // peak number of threads tracing at once. Events a thread left behind stay in its ring until
+    // flushed or overwritten by the next owner, and a tid in the trace names a ring, not a thread.
+    // Names must outlive the flush, string literals in practice.
+    // Without H_TRACE the macros expand to nothing and their arguments are not evaluated.
+    // Not free : a zone costs ~40-55 ns on a VM where rdtsc is slow (bench_trace), paid by every
+    // h_hashmap_get/put/remove and arena/array grow of the translation unit (h_hashmap_get goes from
+    // ~14 to ~87 ns). Define H_TRACE in profiling builds only, H_ALL leaves it off.
+
+#ifndef H_TRACE_BUFFER_EVENTS
+#define H_TRACE_BUFFER_EVENTS (1 << 16)
+#endif
+
+    H_CASSERT((H_TRACE_BUFFER_EVENTS & (H_TRACE_BUFFER_EVENTS - 1)) == 0, H_TRACE_BUFFER_EVENTS)
+
+    typedef enum h_trace_kind_t {
+        H_TRACE_KIND_ZONE,
+        H_TRACE_KIND_COUNTER
+    } h_trace_kind_t;
+
+    typedef struct h_trace_event_t {
+        char const *name;
+        u64 start;
+        u64 value;          // duration in ticks for zones, the value for counters
+        u32 kind;
+        u32 reserved;
+    } h_trace_event_t;
+
+    typedef struct h_trace_buffer_t {
+        u64 head;           // events written, only stored by the owning thread
+        u64 tail;           // events drained, only touched under the flush lock
+        u32 tid;
+        u32 retired;        // set when the owning thread exits, cleared by the thread reusing it
+        struct h_trace_buffer_t *next;
+        h_trace_event_t *events;
+    } h_trace_buffer_t;
+
+    typedef struct h_trace_zone_t {
+        char const *name;
+        u64 start;
+    } h_trace_zone_t;
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(H_TRACE_CLOCK_GETTIME)
+#define H_TRACE_NOW() ((u64)__rdtsc())
+#else
+#define H_TRACE_NOW() _impl_h_trace_clock_ns()
+#endif
+
+    u64 _impl_h_trace_clock_ns(void);
+
+    void h_trace_zone_end(h_trace_zone_t *zone);
+    void h_trace_counter(char const *name, i64 value);
+
+    // Returns the number of events written
+    size_t h_trace_write(FILE *out);
+    bool h_trace_save(char const *path);
+
+#define H_TRACE_BEGIN(zone, name) h_trace_zone_t zone = {(name), H_TRACE_NOW()}
+#define H_TRACE_END(zone) h_trace_zone_end(&(zone))
+    // Zone closing when the enclosing scope exits, early returns included
+#define H_TRACE_ZONE(name) _impl_H_TRACE_ZONE_LINE(name, __LINE__)
+#define _impl_H_TRACE_ZONE_LINE(name, line) \
+    h_trace_zone_t _impl_H_PASTE(_impl_h_trace_zone_, line) __attribute__((cleanup(h_trace_zone_end))) = {(name), H_TRACE_NOW()}
+#define H_TRACE_COUNTER(name, value) h_trace_counter((name), (i64)(value))
+
+#else
+
+#define H_TRACE_BEGIN(zone, name)
+#define H_TRACE_END(zone)
+#define H_TRACE_ZONE(name)
+#define H_TRACE_COUNTER(name, value)
+
+#endif
+
 #ifdef H_DEFINITIONS
 
 #ifdef H_ALLOCATORS
@@ -442,13 +1201,19 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
 #define H_ARENA_ALLOCATOR_BLOCK_SIZE 1024
     h_arena_t *h_arena_create(char const* debug_name) {
         h_arena_t *arena = calloc(1, sizeof(h_arena_t));
-
         void **blocks = calloc(1, sizeof(void*));
-        void *end = blocks[0] = malloc(H_ARENA_ALLOCATOR_BLOCK_SIZE);
+        void *end = blocks ? malloc(H_ARENA_ALLOCATOR_BLOCK_SIZE) : NULL;
+        if (!arena || !end) {
+            free(arena);
+            free(blocks);
+            return NULL;
+        }
+        blocks[0] = end;
 
         arena->blocks = blocks;
         arena->current = blocks;
         arena->end = end;
+        arena->limit = (char*)end + H_ARENA_ALLOCATOR_BLOCK_SIZE;
 
 #ifdef H_DEBUG
         arena->debug_name = debug_name;
@@ -459,37 +1224,50 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
         return arena;
     }
     void h_arena_destroy(h_arena_t *arena) {
-        size_t n_blocks = arena->current - arena->blocks;
+        size_t n_blocks = arena->current - arena->blocks + 1;
         for (size_t i=0;i<n_blocks;++i) free(arena->blocks[i]);
         free(arena->blocks);
         arena->blocks = NULL;
         arena->current = NULL;
         arena->end = NULL;
+        arena->limit = NULL;
 #ifdef H_DEBUG
-        printf("Freeing arena '%s' with %zu bytes allocated\n", arena->debug_name ,n_blocks*H_ARENA_ALLOCATOR_BLOCK_SIZE);
+        printf("Freeing arena '%s' with %zu blocks allocated\n", arena->debug_name ,n_blocks);
         for (int i=0;i<_debug_arena_allocator_registry.size;++i) {
             if (H_ARRAY_GET(h_arena_t*, _debug_arena_allocator_registry, i) == arena)
                 h_array_remove(&_debug_arena_allocator_registry, i);
         }
 #endif
+        free(arena);
     }
     void *h_arena_alloc(h_arena_t *arena, size_t size) {
 
-        if ((char*)arena->end + size > *arena->current + H_ARENA_ALLOCATOR_BLOCK_SIZE) {
-            arena->blocks = realloc(arena->blocks, (arena->current - arena->blocks + 1) * sizeof(void*));
-            arena->current = &arena->blocks[arena->current - arena->blocks];
+        if ((char*)arena->end + size > (char*)arena->limit) {
+            H_TRACE_ZONE("h_arena_alloc grow");
+            size_t n_blocks = arena->current - arena->blocks + 1;
+            void **blocks = realloc(arena->blocks, (n_blocks + 1) * sizeof(void*));
             size_t block_size = ((size + H_ARENA_ALLOCATOR_BLOCK_SIZE - 1) / H_ARENA_ALLOCATOR_BLOCK_SIZE) * H_ARENA_ALLOCATOR_BLOCK_SIZE;
-            *arena->current = malloc(block_size);
-            arena->end = *arena->current;
+            void *block = blocks ? malloc(block_size) : NULL;
+            if (!block) {
+                if (blocks) arena->blocks = blocks;
+                arena->current = &arena->blocks[n_blocks - 1];
+                return NULL;
+            }
+            arena->blocks = blocks;
+            arena->current = &blocks[n_blocks];
+            *arena->current = block;
+            arena->end = block;
+            arena->limit = (char*)block + block_size;
+            H_TRACE_COUNTER("h_arena blocks", n_blocks + 1);
 
 #ifdef H_DEBUG
-            printf("Allocated new %d bytes block for arena '%s'\n", block_size, arena->debug_name);
+            printf("Allocated new %zu bytes block for arena '%s'\n", block_size, arena->debug_name);
 #endif
 
         }
 
         void *ptr = (char*)arena->end;
-        arena->end += size;
+        arena->end = (char*)arena->end + size;
 
 #ifdef H_DEBUG
         printf("Allocated %zu bytes in arena '%s'\n", size, arena->debug_name);
@@ -512,8 +1290,10 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
     void h_array_set(h_array_t *arr, size_t idx, void *val) {
         if (idx >= arr->size) {
             if (idx >= arr->cap) {
+                H_TRACE_ZONE("h_array grow");
                 arr->cap *= 2;
                 arr->data = realloc(arr->data, arr->cap * arr->el_size);
+                H_TRACE_COUNTER("h_array cap", arr->cap);
             }
             arr->size = idx + 1;
         }
@@ -609,207 +1389,2180 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
         queue->size = 0;
     }
 
-#endif
+#define _impl_H_NO_SLOT UINT32_MAX
 
-#ifdef H_HASH
-    u32 h_pcg_hash(u32 seed) {
-        u32 state = seed * 747796405u + 2891336453u;
-        u32 word = (state >> ((state >> 28) + 4)) * 277803737u;
-        return (word >> 22u) ^ word;
+    // doubles a u32 capacity until it holds need, saturating at UINT32_MAX
+    static u32 _impl_h_grow_u32(u32 cap, u32 need) {
+        u64 grown = cap ? cap : 1;
+        while (grown < need) grown *= 2;
+        return grown > UINT32_MAX ? UINT32_MAX : (u32)grown;
     }
 
-    u32 h_hash(h_hash_fn_t *hash_fn, void *val, size_t size) {
-        u32 h = 0x811c9dc5u;
-        for (size_t i=0;i<size;++i) {
-            h ^= *((char*)val + i);
-            h = hash_fn(h);
+    h_slot_map_t h_create_slot_map(size_t el_size, u32 cap) {
+        h_slot_map_t map = {0};
+        map.cap = cap ? cap : 1;
+        map.el_size = el_size;
+        map.values = malloc(map.cap * el_size);
+        map.dense_slots = malloc(map.cap * sizeof(u32));
+        map.slots = malloc(map.cap * sizeof(_impl_h_slot_t));
+        map.free_head = _impl_H_NO_SLOT;
+        if (!map.values || !map.dense_slots || !map.slots) {
+            h_slot_map_free(&map);
         }
+        return map;
     }
 
-#ifdef H_COLLECTIONS
+    // slots only outnumber values while some are free, so the three arrays share one capacity
+    static bool _impl_h_slot_map_grow(h_slot_map_t *map) {
+        // slot indices stay below the _impl_H_NO_SLOT sentinel
+        if (map->cap == UINT32_MAX) return false;
+        u32 cap = _impl_h_grow_u32(map->cap, map->cap + 1);
+        void *values = realloc(map->values, cap * map->el_size);
+        if (!values) return false;
+        map->values = values;
+        u32 *dense_slots = realloc(map->dense_slots, cap * sizeof(u32));
+        if (!dense_slots) return false;
+        map->dense_slots = dense_slots;
+        _impl_h_slot_t *slots = realloc(map->slots, cap * sizeof(_impl_h_slot_t));
+        if (!slots) return false;
+        map->slots = slots;
+        map->cap = cap;
+        return true;
+    }
 
-    h_hashmap_t h_create_hashmap(size_t pair_size,size_t nbuckets, h_kvpair_hash_fn_t *hash_fn, h_kcompare_fn_t *kcompare_fn) {
-        h_hashmap_t hashmap;
-        hashmap.nbuckets = nbuckets;
-        hashmap.pair_size = pair_size;
-        hashmap.size = 0;
-        hashmap.pool_capacity = nbuckets;
-        hashmap.kvpool = calloc(hashmap.pool_capacity, pair_size);
-        hashmap.kvnextpool = calloc(hashmap.pool_capacity, sizeof(size_t));
-        hashmap.buckets = calloc(nbuckets, sizeof(size_t));
-        hashmap.hash_fn = hash_fn;
-        hashmap.kcompare_fn = kcompare_fn;
+    h_handle_t h_slot_map_insert(h_slot_map_t *map, void const *val) {
+        if (map->size == map->cap && !_impl_h_slot_map_grow(map)) return H_NULL_HANDLE;
 
-        return hashmap;
+        u32 slot = map->free_head;
+        if (slot != _impl_H_NO_SLOT) {
+            map->free_head = map->slots[slot].dense;
+        }
+        else {
+            slot = map->nslots++;
+            map->slots[slot].generation = 1;
+        }
+        map->slots[slot].dense = map->size;
+        map->dense_slots[map->size] = slot;
+        memcpy((char*)map->values + (size_t)map->size * map->el_size, val, map->el_size);
+        map->size++;
+        return (h_handle_t){slot, map->slots[slot].generation};
     }
 
-    void *h_hashmap_put(h_hashmap_t *hashmap, void* val) {
-        u32 idx =  hashmap->hash_fn(val) % hashmap->nbuckets;
+    // free slots already carry the generation their next value will get, which no handle has yet
+    static bool _impl_h_slot_map_live(h_slot_map_t const *map, h_handle_t handle) {
+        return handle.index < map->nslots && handle.generation && map->slots[handle.index].generation == handle.generation;
+    }
 
-        size_t pairidx = hashmap->size++;
+    void *h_slot_map_get(h_slot_map_t const *map, h_handle_t handle) {
+        if (!_impl_h_slot_map_live(map, handle)) return NULL;
+        return (char*)map->values + (size_t)map->slots[handle.index].dense * map->el_size;
+    }
+    bool h_slot_map_contains(h_slot_map_t const *map, h_handle_t handle) {
+        return _impl_h_slot_map_live(map, handle);
+    }
 
-        if (hashmap->size < 0) {
-#ifdef H_DEBUG
-            fprintf(stderr,"Hashmap size variable overflowed.\n");
-#endif
-            return NULL;
-        }
+    static void _impl_h_slot_map_release(h_slot_map_t *map, u32 slot) {
+        if (++map->slots[slot].generation == 0) map->slots[slot].generation = 1;
+        map->slots[slot].dense = map->free_head;
+        map->free_head = slot;
+    }
 
-        if (hashmap->size >= hashmap->pool_capacity) {
-            size_t old_pool_capacity = hashmap->pool_capacity;
-            hashmap->pool_capacity *= 2;
-            if (hashmap->pool_capacity < 0) {
-#ifdef H_DEBUG
-                fprintf(stderr,"Hashmap pool capacity variable overflowed.\n");
-#endif
-                return NULL;
-            }
-            hashmap->kvpool = realloc(hashmap->kvpool, hashmap->pool_capacity * hashmap->pair_size);
-            hashmap->kvnextpool = realloc(hashmap->kvnextpool, hashmap->pool_capacity * sizeof(size_t));
-            memset((char*)hashmap->kvnextpool + old_pool_capacity * sizeof(size_t), 0, old_pool_capacity * sizeof(size_t));
-        }
-        memcpy((char*)hashmap->kvpool + pairidx * hashmap->pair_size, val, hashmap->pair_size);
-        if (!hashmap->buckets[idx]) {
-            hashmap->buckets[idx] = pairidx + 1;
-            goto RETURN;
-        }
+    bool h_slot_map_erase(h_slot_map_t *map, h_handle_t handle) {
+        if (!_impl_h_slot_map_live(map, handle)) return false;
 
-        size_t next = hashmap->buckets[idx];
-        size_t last = next;
-        while (next) {
-            last = next;
-            next = hashmap->kvnextpool[next - 1];
+        u32 dense = map->slots[handle.index].dense;
+        u32 last = map->size - 1;
+        if (dense != last) {
+            memcpy((char*)map->values + (size_t)dense * map->el_size, (char*)map->values + (size_t)last * map->el_size, map->el_size);
+            map->dense_slots[dense] = map->dense_slots[last];
+            map->slots[map->dense_slots[dense]].dense = dense;
         }
-        hashmap->kvnextpool[last-1] = pairidx + 1;
+        map->size--;
+        _impl_h_slot_map_release(map, handle.index);
+        return true;
+    }
 
-        RETURN : {}
-        return (char*)hashmap->kvpool + pairidx * hashmap->pair_size;
+    h_handle_t h_slot_map_handle_at(h_slot_map_t const *map, u32 dense) {
+        if (dense >= map->size) return H_NULL_HANDLE;
+        u32 slot = map->dense_slots[dense];
+        return (h_handle_t){slot, map->slots[slot].generation};
     }
 
-    void *h_hashmap_get(h_hashmap_t *hashmap, void* key) {
-        u32 idx =  hashmap->hash_fn(key) % hashmap->nbuckets;
-        size_t pairidx = hashmap->buckets[idx];
-        while (pairidx) {
-            void *pair = (char*)hashmap->kvpool + (pairidx - 1) * hashmap->pair_size;
-            if (hashmap->kcompare_fn(key, pair)) return pair;
-            pairidx = hashmap->kvnextpool[pairidx - 1];
-        }
-        return NULL;
+    void h_slot_map_clear(h_slot_map_t *map) {
+        for (u32 i=0;i<map->size;++i)
+            _impl_h_slot_map_release(map, map->dense_slots[i]);
+        map->size = 0;
+    }
+    void h_slot_map_free(h_slot_map_t *map) {
+        free(map->values);
+        free(map->dense_slots);
+        free(map->slots);
+        *map = (h_slot_map_t){0};
+        map->free_head = _impl_H_NO_SLOT;
     }
-    void h_hashmap_remove(h_hashmap_t *hashmap, void* key) {
-        u32 idx = hashmap->hash_fn(key) % hashmap->nbuckets;
-        size_t pairidx = hashmap->buckets[idx];
-        size_t prev = 0;
 
-        while (pairidx) {
-            void *pair = (char*)hashmap->kvpool + (pairidx - 1) * hashmap->pair_size;
-            if (hashmap->kcompare_fn(key, pair)) break;
-            prev = pairidx;
-            pairidx = hashmap->kvnextpool[pairidx - 1];
+    h_sparse_set_t h_create_sparse_set(size_t el_size, u32 universe) {
+        h_sparse_set_t set = {0};
+        set.cap = 16;
+        set.el_size = el_size;
+        set.universe = universe ? universe : 1;
+        set.dense = malloc(set.cap * sizeof(u32));
+        set.values = el_size ? malloc(set.cap * el_size) : NULL;
+        set.sparse = calloc(set.universe, sizeof(u32));
+        if (!set.dense || (el_size && !set.values) || !set.sparse) {
+            h_sparse_set_free(&set);
         }
-        if (!pairidx) return;
-
-        size_t lastidx = hashmap->size;
+        return set;
+    }
 
-        if (pairidx != lastidx) {
-            // swap last
-            void *dst = (char*)hashmap->kvpool + (pairidx - 1) * hashmap->pair_size;
-            void *src = (char*)hashmap->kvpool + (lastidx - 1) * hashmap->pair_size;
-            memmove(dst, src, hashmap->pair_size);
+    bool h_sparse_set_contains(h_sparse_set_t const *set, u32 id) {
+        return id < set->universe && set->sparse[id] < set->size && set->dense[set->sparse[id]] == id;
+    }
+    void *h_sparse_set_get(h_sparse_set_t const *set, u32 id) {
+        if (!set->el_size || !h_sparse_set_contains(set, id)) return NULL;
+        return (char*)set->values + (size_t)set->sparse[id] * set->el_size;
+    }
 
-            hashmap->kvnextpool[pairidx - 1] = hashmap->kvnextpool[lastidx - 1];
+    // Returns false if id was already present (its value is replaced) or on allocation failure
+    bool h_sparse_set_insert(h_sparse_set_t *set, u32 id, void const *val) {
+        if (id == _impl_H_NO_SLOT) return false;
+        if (h_sparse_set_contains(set, id)) {
+            if (set->el_size && val) memcpy(h_sparse_set_get(set, id), val, set->el_size);
+            return false;
+        }
 
-            for (size_t i = 0; i < hashmap->nbuckets; i++) {
-                if (hashmap->buckets[i] == lastidx) hashmap->buckets[i] = pairidx;
-            }
-            for (size_t i = 0; i < hashmap->size - 1; i++) {
-                if (hashmap->kvnextpool[i] == lastidx) hashmap->kvnextpool[i] = pairidx;
+        if (id >= set->universe) {
+            u32 universe = _impl_h_grow_u32(set->universe, id + 1);
+            u32 *sparse = realloc(set->sparse, (size_t)universe * sizeof(u32));
+            if (!sparse) return false;
+            memset(sparse + set->universe, 0, (size_t)(universe - set->universe) * sizeof(u32));
+            set->sparse = sparse;
+            set->universe = universe;
+        }
+        if (set->size == set->cap) {
+            u32 cap = _impl_h_grow_u32(set->cap, set->cap + 1);
+            u32 *dense = realloc(set->dense, (size_t)cap * sizeof(u32));
+            if (!dense) return false;
+            set->dense = dense;
+            if (set->el_size) {
+                void *values = realloc(set->values, (size_t)cap * set->el_size);
+                if (!values) return false;
+                set->values = values;
             }
-        } else {
+            set->cap = cap;
         }
-        if (prev) {
-            hashmap->kvnextpool[prev - 1] = hashmap->kvnextpool[pairidx - 1];
-        } else {
-            hashmap->buckets[idx] = hashmap->kvnextpool[pairidx - 1];
+
+        set->sparse[id] = set->size;
+        set->dense[set->size] = id;
+        if (set->el_size) {
+            void *dst = (char*)set->values + (size_t)set->size * set->el_size;
+            if (val) memcpy(dst, val, set->el_size);
+            else memset(dst, 0, set->el_size);
         }
-        hashmap->size--;
-    }
-    void h_hashmap_clear(h_hashmap_t *hashmap) {
-        memset(hashmap->buckets, 0, hashmap->nbuckets * sizeof(size_t));
-        memset(hashmap->kvnextpool, 0, hashmap->pool_capacity * sizeof(size_t));
-        hashmap->size = 0;
-    }
-    void h_hashmap_free(h_hashmap_t *hashmap) {
-        free(hashmap->kvpool);
-        free(hashmap->kvnextpool);
-        free(hashmap->buckets);
+        set->size++;
+        return true;
     }
-#endif
-#endif
 
-#ifdef H_RANDOM
-
-    float h_randf(u32 seed) {
-        seed = h_pcg_hash(seed);
-        return (float)seed / (float)(1u << 31);
+    bool h_sparse_set_erase(h_sparse_set_t *set, u32 id) {
+        if (!h_sparse_set_contains(set, id)) return false;
+
+        u32 pos = set->sparse[id];
+        u32 last = set->size - 1;
+        if (pos != last) {
+            u32 moved = set->dense[last];
+            set->dense[pos] = moved;
+            set->sparse[moved] = pos;
+            if (set->el_size)
+                memcpy((char*)set->values + (size_t)pos * set->el_size, (char*)set->values + (size_t)last * set->el_size, set->el_size);
+        }
+        set->size--;
+        return true;
     }
 
-    float h_randf_range(u32 seed, float min, float max) {
-        return min + (max - min) * h_randf(seed);
+    // O(1), stale sparse entries fail the dense back-check
+    void h_sparse_set_clear(h_sparse_set_t *set) {
+        set->size = 0;
+    }
+    void h_sparse_set_free(h_sparse_set_t *set) {
+        free(set->dense);
+        free(set->values);
+        free(set->sparse);
+        *set = (h_sparse_set_t){0};
+    }
+
+#define _impl_H_BTREE_MAX_HEIGHT 64
+#define _impl_H_BTREE_PAD(x) (((x) + 31) & ~(size_t)31)
+#define _impl_H_BTREE_KEY(tree, node, i) ((char*)(node) + sizeof(h_btree_node_t) + (size_t)(i) * (tree)->key_size)
+#define _impl_H_BTREE_PAIR(tree, node, i) ((char*)(node) + (tree)->leaf_pairs + (size_t)(i) * (tree)->pair_size)
+#define _impl_H_BTREE_CHILDREN(tree, node) ((h_btree_node_t**)((char*)(node) + (tree)->inner_children))
+
+    // Integer keys are kept biased so a signed compare orders them, unsigned kinds flip the sign bit
+    static i64 _impl_h_btree_bias(h_btree_t const *tree, void const *key) {
+        switch (tree->key_kind) {
+            case H_BTREE_KEY_U32: { u32 k; memcpy(&k, key, 4); return (i32)(k ^ 0x80000000u); }
+            case H_BTREE_KEY_I32: { i32 k; memcpy(&k, key, 4); return k; }
+            case H_BTREE_KEY_U64: { u64 k; memcpy(&k, key, 8); return (i64)(k ^ 0x8000000000000000ull); }
+            default: { i64 k; memcpy(&k, key, 8); return k; }
+        }
+    }
+    static i64 _impl_h_btree_load_key(h_btree_t const *tree, void const *src) {
+        if (tree->key_size == 4) {
+            i32 k;
+            memcpy(&k, src, 4);
+            return k;
+        }
+        i64 k;
+        memcpy(&k, src, 8);
+        return k;
+    }
+    static void _impl_h_btree_store_key(h_btree_t const *tree, void *dst, i64 biased) {
+        if (tree->key_size == 4) {
+            i32 k = (i32)biased;
+            memcpy(dst, &k, 4);
+        }
+        else memcpy(dst, &biased, 8);
+    }
+
+    // Number of sorted keys below the target (or_equal : not above it). The vector loops may read
+    // past count, key arrays are padded to 32 bytes for that and the extra lanes are masked off.
+    static u32 _impl_h_btree_rank_i64(i64 const *keys, u32 count, i64 target, bool or_equal) {
+#ifdef __AVX2__
+        __m256i t = _mm256_set1_epi64x(target);
+        u32 rank = 0;
+        for (u32 i=0;i<count;i+=4) {
+            __m256i k = _mm256_loadu_si256((__m256i const*)(keys + i));
+            __m256i below = or_equal ? _mm256_xor_si256(_mm256_cmpgt_epi64(k, t), _mm256_set1_epi64x(-1)) : _mm256_cmpgt_epi64(t, k);
+            u32 mask = (u32)_mm256_movemask_pd(_mm256_castsi256_pd(below));
+            if (count - i < 4) mask &= (1u << (count - i)) - 1;
+            rank += (u32)__builtin_popcount(mask);
+            if (mask != 0xf) break;
+        }
+        return rank;
+#else
+        u32 lo = 0, hi = count;
+        while (lo < hi) {
+            u32 mid = (lo + hi) / 2;
+            if (or_equal ? keys[mid] <= target : keys[mid] < target) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+#endif
+    }
+    static u32 _impl_h_btree_rank_i32(i32 const *keys, u32 count, i32 target, bool or_equal) {
+#ifdef __AVX2__
+        __m256i t = _mm256_set1_epi32(target);
+        u32 rank = 0;
+        for (u32 i=0;i<count;i+=8) {
+            __m256i k = _mm256_loadu_si256((__m256i const*)(keys + i));
+            __m256i below = or_equal ? _mm256_xor_si256(_mm256_cmpgt_epi32(k, t), _mm256_set1_epi32(-1)) : _mm256_cmpgt_epi32(t, k);
+            u32 mask = (u32)_mm256_movemask_ps(_mm256_castsi256_ps(below));
+            if (count - i < 8) mask &= (1u << (count - i)) - 1;
+            rank += (u32)__builtin_popcount(mask);
+            if (mask != 0xff) break;
+        }
+        return rank;
+#else
+        u32 lo = 0, hi = count;
+        while (lo < hi) {
+            u32 mid = (lo + hi) / 2;
+            if (or_equal ? keys[mid] <= target : keys[mid] < target) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+#endif
+    }
+    static u32 _impl_h_btree_rank(h_btree_t const *tree, h_btree_node_t const *node, void const *key, i64 biased, bool or_equal) {
+        void const *keys = _impl_H_BTREE_KEY(tree, node, 0);
+        if (tree->key_kind == H_BTREE_KEY_CUSTOM) {
+            u32 lo = 0, hi = node->count;
+            while (lo < hi) {
+                u32 mid = (lo + hi) / 2;
+                int order = tree->order_fn(key, (char const*)keys + (size_t)mid * tree->key_size);
+                if (or_equal ? order >= 0 : order > 0) lo = mid + 1;
+                else hi = mid;
+            }
+            return lo;
+        }
+        if (tree->key_size == 4) return _impl_h_btree_rank_i32(keys, node->count, (i32)biased, or_equal);
+        return _impl_h_btree_rank_i64(keys, node->count, biased, or_equal);
+    }
+    static bool _impl_h_btree_key_eq(h_btree_t const *tree, h_btree_node_t const *leaf, u32 i, void const *key, i64 biased) {
+        if (tree->key_kind == H_BTREE_KEY_CUSTOM) return tree->order_fn(key, _impl_H_BTREE_PAIR(tree, leaf, i)) == 0;
+        return _impl_h_btree_load_key(tree, _impl_H_BTREE_KEY(tree, leaf, i)) == biased;
+    }
+
+    // Nodes come out of arena slabs that double up to 4096 nodes, aligned to a cache line.
+    // Reserving before a split means it can't fail halfway through.
+    static bool _impl_h_btree_reserve(h_btree_t *tree, size_t n) {
+        if ((size_t)(tree->slab_end - tree->slab) >= n * tree->node_size) return true;
+        size_t nodes = n > tree->slab_nodes ? n : tree->slab_nodes;
+        char *block = h_arena_alloc(tree->arena, nodes * tree->node_size + H_CACHE_LINE_SIZE);
+        if (!block) return false;
+        tree->slab = (char*)(((uintptr_t)block + H_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(H_CACHE_LINE_SIZE - 1));
+        tree->slab_end = tree->slab + nodes * tree->node_size;
+        if (tree->slab_nodes < 4096) tree->slab_nodes *= 2;
+        return true;
+    }
+    static h_btree_node_t *_impl_h_btree_node(h_btree_t *tree, bool leaf) {
+        h_btree_node_t *node = (h_btree_node_t*)tree->slab;
+        tree->slab += tree->node_size;
+        node->count = 0;
+        node->leaf = leaf;
+        node->next = NULL;
+        return node;
+    }
+
+    static h_btree_t _impl_h_create_btree(size_t pair_size, h_btree_key_t key_kind, h_korder_fn_t *order_fn) {
+        h_btree_t tree = {0};
+        tree.pair_size = pair_size;
+        tree.key_kind = key_kind;
+        tree.order_fn = order_fn;
+        // custom trees use the pairs themselves as keys, leaves have no separate key array
+        tree.key_size = key_kind == H_BTREE_KEY_CUSTOM ? pair_size : key_kind <= H_BTREE_KEY_I32 ? 4 : 8;
+        size_t header = sizeof(h_btree_node_t);
+
+        // widen the node by cache lines until both kinds of node hold at least 4 entries
+        for (tree.node_size = H_BTREE_NODE_SIZE;;tree.node_size += H_CACHE_LINE_SIZE) {
+            if (key_kind == H_BTREE_KEY_CUSTOM) {
+                tree.leaf_cap = (u32)((tree.node_size - header) / pair_size);
+                tree.leaf_pairs = header;
+            }
+            else {
+                tree.leaf_cap = (u32)((tree.node_size - header) / (tree.key_size + pair_size));
+                while (tree.leaf_cap && header + _impl_H_BTREE_PAD(tree.leaf_cap * tree.key_size) + tree.leaf_cap * pair_size > tree.node_size)
+                    tree.leaf_cap--;
+                tree.leaf_pairs = header + _impl_H_BTREE_PAD(tree.leaf_cap * tree.key_size);
+            }
+            tree.inner_cap = (u32)((tree.node_size - header - sizeof(void*)) / (tree.key_size + sizeof(void*)));
+            while (tree.inner_cap && ((header + _impl_H_BTREE_PAD(tree.inner_cap * tree.key_size) + 7) & ~(size_t)7) + (tree.inner_cap + 1) * sizeof(void*) > tree.node_size)
+                tree.inner_cap--;
+            tree.inner_children = (header + _impl_H_BTREE_PAD(tree.inner_cap * tree.key_size) + 7) & ~(size_t)7;
+            if (tree.leaf_cap >= 4 && tree.inner_cap >= 4) break;
+        }
+
+        tree.arena = h_arena_create("B+tree");
+        tree.scratch = tree.arena ? h_arena_alloc(tree.arena, 2 * tree.key_size) : NULL;
+        tree.slab_nodes = 16;
+        if (!tree.scratch || !_impl_h_btree_reserve(&tree, 1)) {
+            h_btree_free(&tree);
+            return tree;
+        }
+        tree.root = tree.first = _impl_h_btree_node(&tree, true);
+        tree.height = 1;
+        return tree;
+    }
+    h_btree_t h_create_btree(size_t pair_size, h_korder_fn_t *order_fn) {
+        return _impl_h_create_btree(pair_size, H_BTREE_KEY_CUSTOM, order_fn);
+    }
+    h_btree_t h_create_btree_int(size_t pair_size, h_btree_key_t key_kind) {
+        return _impl_h_create_btree(pair_size, key_kind, NULL);
+    }
+
+    static h_btree_node_t *_impl_h_btree_find_leaf(h_btree_t const *tree, void const *key, i64 biased) {
+        h_btree_node_t *node = tree->root;
+        while (!node->leaf)
+            node = _impl_H_BTREE_CHILDREN(tree, node)[_impl_h_btree_rank(tree, node, key, biased, true)];
+        return node;
+    }
+
+    static void _impl_h_btree_leaf_insert(h_btree_t *tree, h_btree_node_t *leaf, u32 i, void const *pair, i64 biased) {
+        u32 moved = leaf->count - i;
+        memmove(_impl_H_BTREE_PAIR(tree, leaf, i + 1), _impl_H_BTREE_PAIR(tree, leaf, i), (size_t)moved * tree->pair_size);
+        memcpy(_impl_H_BTREE_PAIR(tree, leaf, i), pair, tree->pair_size);
+        if (tree->key_kind != H_BTREE_KEY_CUSTOM) {
+            memmove(_impl_H_BTREE_KEY(tree, leaf, i + 1), _impl_H_BTREE_KEY(tree, leaf, i), (size_t)moved * tree->key_size);
+            _impl_h_btree_store_key(tree, _impl_H_BTREE_KEY(tree, leaf, i), biased);
+        }
+        leaf->count++;
+    }
+    // separator goes at pos, its right child at pos + 1
+    static void _impl_h_btree_inner_insert(h_btree_t *tree, h_btree_node_t *node, u32 pos, void const *sep, h_btree_node_t *child) {
+        h_btree_node_t **children = _impl_H_BTREE_CHILDREN(tree, node);
+        memmove(_impl_H_BTREE_KEY(tree, node, pos + 1), _impl_H_BTREE_KEY(tree, node, pos), (size_t)(node->count - pos) * tree->key_size);
+        memcpy(_impl_H_BTREE_KEY(tree, node, pos), sep, tree->key_size);
+        memmove(children + pos + 2, children + pos + 1, (size_t)(node->count - pos) * sizeof(h_btree_node_t*));
+        children[pos + 1] = child;
+        node->count++;
+    }
+
+    void *h_btree_put(h_btree_t *tree, void const *pair) {
+        i64 biased = tree->key_kind != H_BTREE_KEY_CUSTOM ? _impl_h_btree_bias(tree, pair) : 0;
+        h_btree_node_t *path[_impl_H_BTREE_MAX_HEIGHT];
+        u32 slots[_impl_H_BTREE_MAX_HEIGHT];
+        u32 depth = 0;
+
+        h_btree_node_t *leaf = tree->root;
+        while (!leaf->leaf) {
+            u32 i = _impl_h_btree_rank(tree, leaf, pair, biased, true);
+            path[depth] = leaf;
+            slots[depth++] = i;
+            leaf = _impl_H_BTREE_CHILDREN(tree, leaf)[i];
+        }
+        u32 i = _impl_h_btree_rank(tree, leaf, pair, biased, false);
+        if (i < leaf->count && _impl_h_btree_key_eq(tree, leaf, i, pair, biased)) {
+            memcpy(_impl_H_BTREE_PAIR(tree, leaf, i), pair, tree->pair_size);
+            return _impl_H_BTREE_PAIR(tree, leaf, i);
+        }
+        if (leaf->count < tree->leaf_cap) {
+            _impl_h_btree_leaf_insert(tree, leaf, i, pair, biased);
+            tree->size++;
+            return _impl_H_BTREE_PAIR(tree, leaf, i);
+        }
+
+        // a split needs a new leaf, one node per full ancestor, and maybe a new root
+        size_t needed = 2;
+        for (u32 d=depth;d-- > 0 && path[d]->count == tree->inner_cap;) needed++;
+        if (!_impl_h_btree_reserve(tree, needed)) return NULL;
+
+        // appending to the last leaf leaves it full, so ascending inserts pack the leaves
+        h_btree_node_t *right = _impl_h_btree_node(tree, true);
+        u32 count = leaf->count;
+        u32 half = i == count && !leaf->next ? count : count / 2;
+        memcpy(_impl_H_BTREE_PAIR(tree, right, 0), _impl_H_BTREE_PAIR(tree, leaf, half), (size_t)(count - half) * tree->pair_size);
+        if (tree->key_kind != H_BTREE_KEY_CUSTOM)
+            memcpy(_impl_H_BTREE_KEY(tree, right, 0), _impl_H_BTREE_KEY(tree, leaf, half), (size_t)(count - half) * tree->key_size);
+        right->count = count - half;
+        leaf->count = half;
+        right->next = leaf->next;
+        leaf->next = right;
+
+        h_btree_node_t *target = half < count && i <= half ? leaf : right;
+        u32 at = target == leaf ? i : i - half;
+        _impl_h_btree_leaf_insert(tree, target, at, pair, biased);
+        tree->size++;
+        void *out = _impl_H_BTREE_PAIR(tree, target, at);
+
+        char *sep = tree->scratch;
+        char *up = tree->scratch + tree->key_size;
+        memcpy(sep, _impl_H_BTREE_KEY(tree, right, 0), tree->key_size);
+        h_btree_node_t *child = right;
+        while (depth-- > 0) {
+            h_btree_node_t *parent = path[depth];
+            u32 pos = slots[depth];
+            if (parent->count < tree->inner_cap) {
+                _impl_h_btree_inner_insert(tree, parent, pos, sep, child);
+                return out;
+            }
+
+            // the middle separator moves up, the ones after it go right with their children
+            h_btree_node_t *sibling = _impl_h_btree_node(tree, false);
+            u32 mid = parent->count / 2;
+            memcpy(up, _impl_H_BTREE_KEY(tree, parent, mid), tree->key_size);
+            memcpy(_impl_H_BTREE_KEY(tree, sibling, 0), _impl_H_BTREE_KEY(tree, parent, mid + 1), (size_t)(parent->count - mid - 1) * tree->key_size);
+            memcpy(_impl_H_BTREE_CHILDREN(tree, sibling), _impl_H_BTREE_CHILDREN(tree, parent) + mid + 1, (size_t)(parent->count - mid) * sizeof(h_btree_node_t*));
+            sibling->count = parent->count - mid - 1;
+            parent->count = mid;
+            if (pos <= mid) _impl_h_btree_inner_insert(tree, parent, pos, sep, child);
+            else _impl_h_btree_inner_insert(tree, sibling, pos - mid - 1, sep, child);
+
+            char *swap = sep;
+            sep = up;
+            up = swap;
+            child = sibling;
+        }
+
+        h_btree_node_t *root = _impl_h_btree_node(tree, false);
+        memcpy(_impl_H_BTREE_KEY(tree, root, 0), sep, tree->key_size);
+        _impl_H_BTREE_CHILDREN(tree, root)[0] = tree->root;
+        _impl_H_BTREE_CHILDREN(tree, root)[1] = child;
+        root->count = 1;
+        tree->root = root;
+        tree->height++;
+        return out;
+    }
+
+    void *h_btree_get(h_btree_t const *tree, void const *key) {
+        i64 biased = tree->key_kind != H_BTREE_KEY_CUSTOM ? _impl_h_btree_bias(tree, key) : 0;
+        h_btree_node_t *leaf = _impl_h_btree_find_leaf(tree, key, biased);
+        u32 i = _impl_h_btree_rank(tree, leaf, key, biased, false);
+        if (i < leaf->count && _impl_h_btree_key_eq(tree, leaf, i, key, biased)) return _impl_H_BTREE_PAIR(tree, leaf, i);
+        return NULL;
+    }
+
+    bool h_btree_remove(h_btree_t *tree, void const *key) {
+        i64 biased = tree->key_kind != H_BTREE_KEY_CUSTOM ? _impl_h_btree_bias(tree, key) : 0;
+        h_btree_node_t *leaf = _impl_h_btree_find_leaf(tree, key, biased);
+        u32 i = _impl_h_btree_rank(tree, leaf, key, biased, false);
+        if (i >= leaf->count || !_impl_h_btree_key_eq(tree, leaf, i, key, biased)) return false;
+
+        u32 moved = leaf->count - i - 1;
+        memmove(_impl_H_BTREE_PAIR(tree, leaf, i), _impl_H_BTREE_PAIR(tree, leaf, i + 1), (size_t)moved * tree->pair_size);
+        if (tree->key_kind != H_BTREE_KEY_CUSTOM)
+            memmove(_impl_H_BTREE_KEY(tree, leaf, i), _impl_H_BTREE_KEY(tree, leaf, i + 1), (size_t)moved * tree->key_size);
+        leaf->count--;
+        tree->size--;
+        return true;
+    }
+
+    // Leaves are filled evenly then each level above is built from the one below, every node
+    // holding at least half its capacity. Separators are the first key of each child's subtree.
+    bool h_btree_bulk_load(h_btree_t *tree, h_array_t const *sorted) {
+        if (tree->size || sorted->el_size != tree->pair_size) return false;
+        size_t n = sorted->size;
+        if (!n) return true;
+
+        char const *pairs = sorted->data;
+        for (size_t i=1;i<n;++i) {
+            void const *prev = pairs + (i - 1) * tree->pair_size;
+            void const *cur = pairs + i * tree->pair_size;
+            bool ascending = tree->key_kind == H_BTREE_KEY_CUSTOM ? tree->order_fn(cur, prev) > 0 : _impl_h_btree_bias(tree, cur) > _impl_h_btree_bias(tree, prev);
+            if (!ascending) return false;
+        }
+
+        size_t nleaves = (n + tree->leaf_cap - 1) / tree->leaf_cap;
+        size_t nodes = nleaves;
+        for (size_t m=nleaves;m > 1;) {
+            m = (m + tree->inner_cap) / (tree->inner_cap + 1);
+            nodes += m;
+        }
+        h_btree_node_t **level = malloc(nleaves * sizeof(h_btree_node_t*));
+        char const **mins = malloc(nleaves * sizeof(char*));
+        if (!level || !mins || !_impl_h_btree_reserve(tree, nodes)) {
+            free(level);
+            free(mins);
+            return false;
+        }
+
+        h_btree_node_t *first = NULL;
+        size_t base = n / nleaves, extra = n % nleaves;
+        for (size_t j=0, next=0;j<nleaves;++j) {
+            // an emptied tree may have inner nodes left, only a lone root leaf is reused
+            h_btree_node_t *leaf = j || !tree->root->leaf ? _impl_h_btree_node(tree, true) : tree->root;
+            u32 count = (u32)(base + (j < extra));
+            memcpy(_impl_H_BTREE_PAIR(tree, leaf, 0), pairs + next * tree->pair_size, (size_t)count * tree->pair_size);
+            if (tree->key_kind != H_BTREE_KEY_CUSTOM)
+                for (u32 k=0;k<count;++k)
+                    _impl_h_btree_store_key(tree, _impl_H_BTREE_KEY(tree, leaf, k), _impl_h_btree_bias(tree, _impl_H_BTREE_PAIR(tree, leaf, k)));
+            leaf->count = count;
+            if (j) level[j - 1]->next = leaf;
+            else first = leaf;
+            level[j] = leaf;
+            mins[j] = _impl_H_BTREE_KEY(tree, leaf, 0);
+            next += count;
+        }
+
+        // parents are written in place over the level below, never ahead of their children
+        size_t m = nleaves;
+        u32 height = 1;
+        while (m > 1) {
+            size_t parents = (m + tree->inner_cap) / (tree->inner_cap + 1);
+            base = m / parents;
+            extra = m % parents;
+            for (size_t p=0, next=0;p<parents;++p) {
+                h_btree_node_t *node = _impl_h_btree_node(tree, false);
+                u32 count = (u32)(base + (p < extra));
+                memcpy(_impl_H_BTREE_CHILDREN(tree, node), level + next, count * sizeof(h_btree_node_t*));
+                for (u32 k=1;k<count;++k)
+                    memcpy(_impl_H_BTREE_KEY(tree, node, k - 1), mins[next + k], tree->key_size);
+                node->count = count - 1;
+                level[p] = node;
+                mins[p] = mins[next];
+                next += count;
+            }
+            m = parents;
+            height++;
+        }
+
+        tree->first = first;
+        tree->root = level[0];
+        tree->height = height;
+        tree->size = n;
+        free(level);
+        free(mins);
+        return true;
+    }
+
+    h_btree_cursor_t h_btree_range(h_btree_t const *tree, void const *lo, void const *hi) {
+        h_btree_cursor_t cursor = {tree, tree->first, 0, hi};
+        if (lo) {
+            i64 biased = tree->key_kind != H_BTREE_KEY_CUSTOM ? _impl_h_btree_bias(tree, lo) : 0;
+            cursor.leaf = _impl_h_btree_find_leaf(tree, lo, biased);
+            cursor.idx = _impl_h_btree_rank(tree, cursor.leaf, lo, biased, false);
+        }
+        return cursor;
+    }
+    void *h_btree_next(h_btree_cursor_t *cursor) {
+        h_btree_t const *tree = cursor->tree;
+        while (cursor->leaf && cursor->idx >= cursor->leaf->count) {
+            cursor->leaf = cursor->leaf->next;
+            cursor->idx = 0;
+        }
+        if (!cursor->leaf) return NULL;
+
+        if (cursor->hi) {
+            bool below = tree->key_kind == H_BTREE_KEY_CUSTOM
+                ? tree->order_fn(cursor->hi, _impl_H_BTREE_PAIR(tree, cursor->leaf, cursor->idx)) > 0
+                : _impl_h_btree_load_key(tree, _impl_H_BTREE_KEY(tree, cursor->leaf, cursor->idx)) < _impl_h_btree_bias(tree, cursor->hi);
+            if (!below) {
+                cursor->leaf = NULL;
+                return NULL;
+            }
+        }
+        return _impl_H_BTREE_PAIR(tree, cursor->leaf, cursor->idx++);
+    }
+    void *h_btree_lower_bound(h_btree_t const *tree, void const *key) {
+        h_btree_cursor_t cursor = h_btree_range(tree, key, NULL);
+        return h_btree_next(&cursor);
+    }
+
+    void h_btree_free(h_btree_t *tree) {
+        if (tree->arena) h_arena_destroy(tree->arena);
+        *tree = (h_btree_t){0};
+    }
+
+#endif
+
+#ifdef H_HASH
+    u32 h_pcg_hash(u32 seed) {
+        u32 state = seed * 747796405u + 2891336453u;
+        u32 word = ((state >> ((state >> 28) + 4)) ^ state) * 277803737u;
+        return (word >> 22u) ^ word;
+    }
+
+    u32 h_hash(h_hash_fn_t *hash_fn, void *val, size_t size) {
+        u32 h = 0x811c9dc5u;
+        for (size_t i=0;i<size;++i) {
+            h ^= *((char*)val + i);
+            h = hash_fn(h);
+        }
+        return h;
+    }
+
+    static u64 _impl_h_hash_bytes_mix(void const *data, size_t size, u64 seed) {
+        unsigned char const *p = (unsigned char const*)data;
+        u64 h = 0x9e3779b97f4a7c15ull ^ size ^ seed;
+        while (size >= 8) {
+            u64 w;
+            memcpy(&w, p, 8);
+            h = (h ^ w) * 0xff51afd7ed558ccdull;
+            h ^= h >> 32;
+            p += 8;
+            size -= 8;
+        }
+        if (size) {
+            u64 w = 0;
+            memcpy(&w, p, size);
+            h = (h ^ w) * 0xff51afd7ed558ccdull;
+            h ^= h >> 32;
+        }
+        return h;
+    }
+    u32 h_hash_bytes(void const *data, size_t size) {
+        u64 h = _impl_h_hash_bytes_mix(data, size, 0);
+        return h_pcg_hash((u32)h ^ (u32)(h >> 29));
+    }
+    static u64 _impl_h_hash_fmix64(u64 h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+    u64 h_hash_bytes64(void const *data, size_t size) {
+        return _impl_h_hash_fmix64(_impl_h_hash_bytes_mix(data, size, 0));
+    }
+
+#define _impl_H_PHASH_MAX_SEEDS 64
+#define _impl_H_PHASH_MAX_DISP 65536
+
+    u64 h_phash_hash_bytes(void const *data, size_t size, u32 seed) {
+        // seeded from the first word on, keys colliding under one seed are unrelated under the next
+        return _impl_h_hash_fmix64(_impl_h_hash_bytes_mix(data, size, (u64)seed * 0xc2b2ae3d27d4eb4full));
+    }
+
+    static int _impl_h_phash_cmp_u64(void const *a, void const *b) {
+        u64 x = *(u64 const*)a, y = *(u64 const*)b;
+        return (x > y) - (x < y);
+    }
+
+    // Places every bucket, largest first, fails when two keys share a hash or a bucket runs out
+    // of displacements so the caller can retry with another seed
+    static bool _impl_h_phash_build(h_phash_t *phash, u64 const *hashes) {
+        u32 n = phash->nkeys;
+        u32 nbuckets = 1u << phash->bucket_bits, nslots = 1u << phash->slot_bits;
+        u64 *sorted = malloc((n + 1) * sizeof(u64));
+        u32 *offsets = calloc(nbuckets + 1, sizeof(u32));
+        u32 *members = malloc((n + 1) * sizeof(u32));
+        u32 *order = malloc(nbuckets * sizeof(u32));
+        u32 *by_size = calloc(n + 2, sizeof(u32));
+        bool ok = sorted && offsets && members && order && by_size;
+
+        if (ok) {
+            memcpy(sorted, hashes, n * sizeof(u64));
+            qsort(sorted, n, sizeof(u64), _impl_h_phash_cmp_u64);
+            for (u32 i=1;i<n && ok;++i) ok = sorted[i] != sorted[i - 1];
+        }
+        if (ok) {
+            // keys grouped by bucket, then buckets counting-sorted by decreasing size
+            for (u32 i=0;i<n;++i) offsets[H_PHASH_BUCKET(hashes[i], phash->bucket_bits) + 1]++;
+            for (u32 b=0;b<nbuckets;++b) offsets[b + 1] += offsets[b];
+            for (u32 i=0;i<n;++i) members[offsets[H_PHASH_BUCKET(hashes[i], phash->bucket_bits)]++] = i;
+            for (u32 b=nbuckets;b-- > 0;) offsets[b + 1] = offsets[b];
+            offsets[0] = 0;
+
+            for (u32 b=0;b<nbuckets;++b) by_size[n - (offsets[b + 1] - offsets[b]) + 1]++;
+            for (u32 s=0;s<=n;++s) by_size[s + 1] += by_size[s];
+            for (u32 b=0;b<nbuckets;++b) order[by_size[n - (offsets[b + 1] - offsets[b])]++] = b;
+
+            for (u32 s=0;s<nslots;++s) phash->slots[s] = H_PHASH_EMPTY;
+            for (u32 o=0;o<nbuckets && ok;++o) {
+                u32 b = order[o];
+                u32 first = offsets[b], last = offsets[b + 1];
+                phash->disp[b] = 0;
+                if (first == last) continue;
+
+                u32 d = 0;
+                for (;d<_impl_H_PHASH_MAX_DISP;++d) {
+                    u32 placed = first;
+                    for (;placed<last;++placed) {
+                        u32 s = H_PHASH_SLOT(hashes[members[placed]], d, phash->slot_bits);
+                        if (phash->slots[s] != H_PHASH_EMPTY) break;
+                        phash->slots[s] = members[placed];
+                    }
+                    if (placed == last) break;
+                    while (placed-- > first) phash->slots[H_PHASH_SLOT(hashes[members[placed]], d, phash->slot_bits)] = H_PHASH_EMPTY;
+                }
+                ok = d < _impl_H_PHASH_MAX_DISP;
+                phash->disp[b] = (u16)d;
+            }
+        }
+
+        free(sorted);
+        free(offsets);
+        free(members);
+        free(order);
+        free(by_size);
+        return ok;
+    }
+
+    static h_phash_t _impl_h_create_phash(u32 nkeys, void const *u32_keys, void const *const *keys, size_t const *sizes) {
+        h_phash_t phash = {0};
+        phash.nkeys = nkeys;
+        while ((1ull << phash.slot_bits) < (u64)nkeys + nkeys / 4 + 1) phash.slot_bits++;
+        while ((1ull << phash.bucket_bits) < (u64)nkeys / 4) phash.bucket_bits++;
+        phash.disp = malloc(((size_t)1 << phash.bucket_bits) * sizeof(u16));
+        phash.slots = malloc(((size_t)1 << phash.slot_bits) * sizeof(u32));
+        u64 *hashes = malloc(((size_t)nkeys + 1) * sizeof(u64));
+
+        bool ok = false;
+        for (u32 attempt=0;phash.disp && phash.slots && hashes && !ok && attempt<_impl_H_PHASH_MAX_SEEDS;++attempt) {
+            phash.seed = h_pcg_hash(attempt + 1);
+            for (u32 i=0;i<nkeys;++i)
+                hashes[i] = u32_keys ? H_PHASH_HASH(((u32 const*)u32_keys)[i], phash.seed) : h_phash_hash_bytes(keys[i], sizes[i], phash.seed);
+            ok = _impl_h_phash_build(&phash, hashes);
+        }
+        free(hashes);
+        if (!ok) h_phash_free(&phash);
+        return phash;
+    }
+    h_phash_t h_create_phash_u32(u32 const *keys, u32 nkeys) {
+        return _impl_h_create_phash(nkeys, keys, NULL, NULL);
+    }
+    h_phash_t h_create_phash_bytes(void const *const *keys, size_t const *sizes, u32 nkeys) {
+        return _impl_h_create_phash(nkeys, NULL, keys, sizes);
+    }
+
+    u32 h_phash_lookup(h_phash_t const *phash, u64 hash) {
+        return phash->slots[H_PHASH_SLOT(hash, phash->disp[H_PHASH_BUCKET(hash, phash->bucket_bits)], phash->slot_bits)];
+    }
+    void h_phash_free(h_phash_t *phash) {
+        free(phash->disp);
+        free(phash->slots);
+        *phash = (h_phash_t){0};
+    }
+
+#ifdef H_COLLECTIONS
+
+    h_hashmap_t h_create_hashmap(size_t pair_size,size_t nbuckets, h_kvpair_hash_fn_t *hash_fn, h_kcompare_fn_t *kcompare_fn) {
+        h_hashmap_t hashmap;
+        hashmap.nbuckets = nbuckets;
+        hashmap.pair_size = pair_size;
+        hashmap.size = 0;
+        hashmap.pool_capacity = nbuckets;
+        hashmap.kvpool = calloc(hashmap.pool_capacity, pair_size);
+        hashmap.kvnextpool = calloc(hashmap.pool_capacity, sizeof(size_t));
+        hashmap.buckets = calloc(nbuckets, sizeof(size_t));
+        hashmap.hash_fn = hash_fn;
+        hashmap.kcompare_fn = kcompare_fn;
+
+        return hashmap;
+    }
+
+    void *h_hashmap_put(h_hashmap_t *hashmap, void* val) {
+        H_TRACE_ZONE("h_hashmap_put");
+        u32 idx =  hashmap->hash_fn(val) % hashmap->nbuckets;
+
+        size_t pairidx = hashmap->size++;
+
+        if (hashmap->size < 0) {
+#ifdef H_DEBUG
+            fprintf(stderr,"Hashmap size variable overflowed.\n");
+#endif
+            return NULL;
+        }
+
+        if (hashmap->size >= hashmap->pool_capacity) {
+            H_TRACE_ZONE("h_hashmap_put grow");
+            size_t old_pool_capacity = hashmap->pool_capacity;
+            hashmap->pool_capacity *= 2;
+            if (hashmap->pool_capacity < 0) {
+#ifdef H_DEBUG
+                fprintf(stderr,"Hashmap pool capacity variable overflowed.\n");
+#endif
+                return NULL;
+            }
+            hashmap->kvpool = realloc(hashmap->kvpool, hashmap->pool_capacity * hashmap->pair_size);
+            hashmap->kvnextpool = realloc(hashmap->kvnextpool, hashmap->pool_capacity * sizeof(size_t));
+            memset((char*)hashmap->kvnextpool + old_pool_capacity * sizeof(size_t), 0, old_pool_capacity * sizeof(size_t));
+            H_TRACE_COUNTER("h_hashmap pool", hashmap->pool_capacity);
+        }
+        memcpy((char*)hashmap->kvpool + pairidx * hashmap->pair_size, val, hashmap->pair_size);
+        if (!hashmap->buckets[idx]) {
+            hashmap->buckets[idx] = pairidx + 1;
+            goto RETURN;
+        }
+
+        size_t next = hashmap->buckets[idx];
+        size_t last = next;
+        while (next) {
+            last = next;
+            next = hashmap->kvnextpool[next - 1];
+        }
+        hashmap->kvnextpool[last-1] = pairidx + 1;
+
+        RETURN : {}
+        return (char*)hashmap->kvpool + pairidx * hashmap->pair_size;
+    }
+
+    void *h_hashmap_get(h_hashmap_t *hashmap, void* key) {
+        H_TRACE_ZONE("h_hashmap_get");
+        u32 idx =  hashmap->hash_fn(key) % hashmap->nbuckets;
+        size_t pairidx = hashmap->buckets[idx];
+        while (pairidx) {
+            void *pair = (char*)hashmap->kvpool + (pairidx - 1) * hashmap->pair_size;
+            if (hashmap->kcompare_fn(key, pair)) return pair;
+            pairidx = hashmap->kvnextpool[pairidx - 1];
+        }
+        return NULL;
+    }
+    void h_hashmap_remove(h_hashmap_t *hashmap, void* key) {
+        H_TRACE_ZONE("h_hashmap_remove");
+        u32 idx = hashmap->hash_fn(key) % hashmap->nbuckets;
+        size_t pairidx = hashmap->buckets[idx];
+        size_t prev = 0;
+
+        while (pairidx) {
+            void *pair = (char*)hashmap->kvpool + (pairidx - 1) * hashmap->pair_size;
+            if (hashmap->kcompare_fn(key, pair)) break;
+            prev = pairidx;
+            pairidx = hashmap->kvnextpool[pairidx - 1];
+        }
+        if (!pairidx) return;
+
+        // unlink before moving the last pair in, the moved pair may be prev or next
+        if (prev) {
+            hashmap->kvnextpool[prev - 1] = hashmap->kvnextpool[pairidx - 1];
+        } else {
+            hashmap->buckets[idx] = hashmap->kvnextpool[pairidx - 1];
+        }
+
+        size_t lastidx = hashmap->size;
+
+        if (pairidx != lastidx) {
+            // swap last
+            void *dst = (char*)hashmap->kvpool + (pairidx - 1) * hashmap->pair_size;
+            void *src = (char*)hashmap->kvpool + (lastidx - 1) * hashmap->pair_size;
+            memmove(dst, src, hashmap->pair_size);
+
+            hashmap->kvnextpool[pairidx - 1] = hashmap->kvnextpool[lastidx - 1];
+
+            for (size_t i = 0; i < hashmap->nbuckets; i++) {
+                if (hashmap->buckets[i] == lastidx) hashmap->buckets[i] = pairidx;
+            }
+            for (size_t i = 0; i < hashmap->size - 1; i++) {
+                if (hashmap->kvnextpool[i] == lastidx) hashmap->kvnextpool[i] = pairidx;
+            }
+        }
+        // put expects free slots to have no successor
+        hashmap->kvnextpool[lastidx - 1] = 0;
+        hashmap->size--;
+    }
+    void h_hashmap_clear(h_hashmap_t *hashmap) {
+        memset(hashmap->buckets, 0, hashmap->nbuckets * sizeof(size_t));
+        memset(hashmap->kvnextpool, 0, hashmap->pool_capacity * sizeof(size_t));
+        hashmap->size = 0;
+    }
+    void h_hashmap_free(h_hashmap_t *hashmap) {
+        free(hashmap->kvpool);
+        free(hashmap->kvnextpool);
+        free(hashmap->buckets);
+    }
+#endif
+#endif
+
+#ifdef H_RANDOM
+
+    float h_randf(u32 seed) {
+        seed = h_pcg_hash(seed);
+        return (float)(seed >> 8) * 0x1.0p-24f;
+    }
+
+    float h_randf_range(u32 seed, float min, float max) {
+        return min + (max - min) * h_randf(seed);
     }
 
     i32 h_randi(u32 seed, i32 min, i32 max) {
         return min + (i32)(h_randf(seed) * (max - min + 1));
     }
-#endif
-
-#ifdef H_STRING
 
-    h_string_t h_tostring(h_cstr_t cstr) {
-        return (h_string_t){cstr, cstr?strlen(cstr):0};
+    // Stateful generator
+
+    static inline u64 _impl_h_rotl64(u64 x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    static inline u64 _impl_h_splitmix64(u64 *state) {
+        u64 z = (*state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    h_rng_t h_create_rng(u64 seed) {
+        h_rng_t rng;
+        for (int i=0;i<4;++i) rng.s[i] = _impl_h_splitmix64(&seed);
+        return rng;
+    }
+
+    u64 h_rng_next_u64(h_rng_t *rng) {
+        u64 *s = rng->s;
+        u64 result = _impl_h_rotl64(s[1] * 5, 7) * 9;
+        u64 t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = _impl_h_rotl64(s[3], 45);
+        return result;
+    }
+    u32 h_rng_next_u32(h_rng_t *rng) {
+        return (u32)(h_rng_next_u64(rng) >> 32);
+    }
+    f32 h_rng_next_f32(h_rng_t *rng) {
+        return (f32)(h_rng_next_u64(rng) >> 40) * 0x1.0p-24f;
+    }
+    f64 h_rng_next_f64(h_rng_t *rng) {
+        return (f64)(h_rng_next_u64(rng) >> 11) * 0x1.0p-53;
+    }
+
+    // Lemire's multiply and reject, unbiased for any bound
+    u32 h_rng_bounded_u32(h_rng_t *rng, u32 bound) {
+        if (!bound) return 0;
+        u64 m = (u64)h_rng_next_u32(rng) * bound;
+        if ((u32)m < bound) {
+            u32 threshold = -bound % bound;
+            while ((u32)m < threshold) m = (u64)h_rng_next_u32(rng) * bound;
+        }
+        return (u32)(m >> 32);
+    }
+    u64 h_rng_bounded_u64(h_rng_t *rng, u64 bound) {
+        if (!bound) return 0;
+        __uint128_t m = (__uint128_t)h_rng_next_u64(rng) * bound;
+        if ((u64)m < bound) {
+            u64 threshold = -bound % bound;
+            while ((u64)m < threshold) m = (__uint128_t)h_rng_next_u64(rng) * bound;
+        }
+        return (u64)(m >> 64);
+    }
+    i32 h_rng_range_i32(h_rng_t *rng, i32 min, i32 max) {
+        if (max <= min) return min;
+        u32 span = (u32)((i64)max - (i64)min) + 1;
+        if (!span) return (i32)h_rng_next_u32(rng);
+        return (i32)((i64)min + h_rng_bounded_u32(rng, span));
+    }
+
+    // Bulk fill, the H_RNG_LANES generators are stored lane-major so each state word is one vector
+
+    typedef struct _impl_h_rng_lanes_t {
+        u64 s[4][H_RNG_LANES] __attribute__((aligned(32)));
+    } _impl_h_rng_lanes_t;
+
+    static void _impl_h_rng_lanes_seed(_impl_h_rng_lanes_t *lanes, h_rng_t *rng) {
+        for (int l=0;l<H_RNG_LANES;++l) {
+            h_rng_t sub = h_create_rng(h_rng_next_u64(rng));
+            for (int i=0;i<4;++i) lanes->s[i][l] = sub.s[i];
+        }
+    }
+
+#ifdef __AVX2__
+    static inline __m256i _impl_h_rotl64_avx2(__m256i x, int k) {
+        return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+    }
+#endif
+
+    static inline void _impl_h_rng_lanes_next(_impl_h_rng_lanes_t *lanes, u64 *out) {
+#ifdef __AVX2__
+        for (int l=0;l<H_RNG_LANES;l+=4) {
+            __m256i s0 = _mm256_load_si256((__m256i*)&lanes->s[0][l]);
+            __m256i s1 = _mm256_load_si256((__m256i*)&lanes->s[1][l]);
+            __m256i s2 = _mm256_load_si256((__m256i*)&lanes->s[2][l]);
+            __m256i s3 = _mm256_load_si256((__m256i*)&lanes->s[3][l]);
+
+            // *5 and *9 as shift + add, AVX2 has no 64 bit multiply
+            __m256i x = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+            x = _impl_h_rotl64_avx2(x, 7);
+            x = _mm256_add_epi64(_mm256_slli_epi64(x, 3), x);
+            _mm256_storeu_si256((__m256i*)&out[l], x);
+
+            __m256i t = _mm256_slli_epi64(s1, 17);
+            s2 = _mm256_xor_si256(s2, s0);
+            s3 = _mm256_xor_si256(s3, s1);
+            s1 = _mm256_xor_si256(s1, s2);
+            s0 = _mm256_xor_si256(s0, s3);
+            s2 = _mm256_xor_si256(s2, t);
+            s3 = _impl_h_rotl64_avx2(s3, 45);
+
+            _mm256_store_si256((__m256i*)&lanes->s[0][l], s0);
+            _mm256_store_si256((__m256i*)&lanes->s[1][l], s1);
+            _mm256_store_si256((__m256i*)&lanes->s[2][l], s2);
+            _mm256_store_si256((__m256i*)&lanes->s[3][l], s3);
+        }
+#else
+        for (int l=0;l<H_RNG_LANES;++l) {
+            u64 s0 = lanes->s[0][l], s1 = lanes->s[1][l], s2 = lanes->s[2][l], s3 = lanes->s[3][l];
+            out[l] = _impl_h_rotl64(s1 * 5, 7) * 9;
+            u64 t = s1 << 17;
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            lanes->s[0][l] = s0;
+            lanes->s[1][l] = s1;
+            lanes->s[2][l] = s2;
+            lanes->s[3][l] = _impl_h_rotl64(s3, 45);
+        }
+#endif
+    }
+
+    void h_rng_fill_u64(h_rng_t *rng, u64 *out, size_t n) {
+        size_t i = 0;
+        if (n >= 4 * H_RNG_LANES) {
+            _impl_h_rng_lanes_t lanes;
+            _impl_h_rng_lanes_seed(&lanes, rng);
+            for (;i+H_RNG_LANES<=n;i+=H_RNG_LANES) _impl_h_rng_lanes_next(&lanes, out + i);
+        }
+        for (;i<n;++i) out[i] = h_rng_next_u64(rng);
+    }
+    void h_rng_fill_u32(h_rng_t *rng, u32 *out, size_t n) {
+        size_t i = 0;
+        if (n >= 8 * H_RNG_LANES) {
+            _impl_h_rng_lanes_t lanes;
+            _impl_h_rng_lanes_seed(&lanes, rng);
+            u64 block[H_RNG_LANES];
+            for (;i+2*H_RNG_LANES<=n;i+=2*H_RNG_LANES) {
+                _impl_h_rng_lanes_next(&lanes, block);
+                memcpy(out + i, block, sizeof(block));
+            }
+        }
+        for (;i<n;++i) out[i] = h_rng_next_u32(rng);
+    }
+    void h_rng_fill_f32(h_rng_t *rng, f32 *out, size_t n) {
+        size_t i = 0;
+        if (n >= 8 * H_RNG_LANES) {
+            _impl_h_rng_lanes_t lanes;
+            _impl_h_rng_lanes_seed(&lanes, rng);
+            u64 block[H_RNG_LANES] __attribute__((aligned(32)));
+            for (;i+2*H_RNG_LANES<=n;i+=2*H_RNG_LANES) {
+                _impl_h_rng_lanes_next(&lanes, block);
+#ifdef __AVX2__
+                __m256 scale = _mm256_set1_ps(0x1.0p-24f);
+                for (int j=0;j<H_RNG_LANES;j+=4) {
+                    __m256i bits = _mm256_srli_epi32(_mm256_load_si256((__m256i*)&block[j]), 8);
+                    _mm256_storeu_ps(out + i + 2 * j, _mm256_mul_ps(_mm256_cvtepi32_ps(bits), scale));
+                }
+#else
+                for (int j=0;j<H_RNG_LANES;++j) {
+                    out[i + 2 * j] = (f32)((u32)block[j] >> 8) * 0x1.0p-24f;
+                    out[i + 2 * j + 1] = (f32)(block[j] >> 40) * 0x1.0p-24f;
+                }
+#endif
+            }
+        }
+        for (;i<n;++i) out[i] = h_rng_next_f32(rng);
+    }
+
+    // Substreams
+
+    static void _impl_h_rng_jump_with(h_rng_t *rng, u64 const jump[4]) {
+        u64 s[4] = {0};
+        for (int i=0;i<4;++i) {
+            for (int b=0;b<64;++b) {
+                if (jump[i] & (1ULL << b))
+                    for (int w=0;w<4;++w) s[w] ^= rng->s[w];
+                h_rng_next_u64(rng);
+            }
+        }
+        memcpy(rng->s, s, sizeof(s));
+    }
+
+    void h_rng_jump(h_rng_t *rng) {
+        static const u64 jump[4] = {0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull};
+        _impl_h_rng_jump_with(rng, jump);
+    }
+    void h_rng_long_jump(h_rng_t *rng) {
+        static const u64 jump[4] = {0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull, 0x77710069854ee241ull, 0x39109bb02acbe635ull};
+        _impl_h_rng_jump_with(rng, jump);
+    }
+    h_rng_t h_rng_substream(h_rng_t const *master, size_t idx) {
+        h_rng_t rng = *master;
+        for (size_t i=0;i<=idx;++i) h_rng_jump(&rng);
+        return rng;
+    }
+    void h_rng_split(h_rng_t *master, h_rng_t *streams, size_t n) {
+        // same streams as h_rng_substream(master, 0..n-1), master ends after the last one
+        for (size_t i=0;i<n;++i) {
+            h_rng_jump(master);
+            streams[i] = *master;
+        }
+    }
+
+    // Ziggurat tables (Marsaglia & Tsang, in Doornik's formulation), built once at load
+
+#define _impl_H_ZIG_NORMAL_LAYERS 128
+#define _impl_H_ZIG_NORMAL_R 3.442619855899
+#define _impl_H_ZIG_NORMAL_V 9.91256303526217e-3
+#define _impl_H_ZIG_EXP_LAYERS 256
+#define _impl_H_ZIG_EXP_R 7.69711747013104972
+#define _impl_H_ZIG_EXP_V 3.949659822581572e-3
+
+    static f64 _impl_h_zig_normal_x[_impl_H_ZIG_NORMAL_LAYERS + 1];
+    static f64 _impl_h_zig_normal_r[_impl_H_ZIG_NORMAL_LAYERS];
+    static f64 _impl_h_zig_exp_x[_impl_H_ZIG_EXP_LAYERS + 1];
+    static f64 _impl_h_zig_exp_r[_impl_H_ZIG_EXP_LAYERS];
+
+    __attribute__((constructor))
+    static void _impl_h_ziggurat_init() {
+        f64 f = exp(-0.5 * _impl_H_ZIG_NORMAL_R * _impl_H_ZIG_NORMAL_R);
+        _impl_h_zig_normal_x[0] = _impl_H_ZIG_NORMAL_V / f;
+        _impl_h_zig_normal_x[1] = _impl_H_ZIG_NORMAL_R;
+        _impl_h_zig_normal_x[_impl_H_ZIG_NORMAL_LAYERS] = 0.0;
+        for (int i=2;i<_impl_H_ZIG_NORMAL_LAYERS;++i) {
+            _impl_h_zig_normal_x[i] = sqrt(-2.0 * log(_impl_H_ZIG_NORMAL_V / _impl_h_zig_normal_x[i - 1] + f));
+            f = exp(-0.5 * _impl_h_zig_normal_x[i] * _impl_h_zig_normal_x[i]);
+        }
+        for (int i=0;i<_impl_H_ZIG_NORMAL_LAYERS;++i)
+            _impl_h_zig_normal_r[i] = _impl_h_zig_normal_x[i + 1] / _impl_h_zig_normal_x[i];
+
+        f = exp(-_impl_H_ZIG_EXP_R);
+        _impl_h_zig_exp_x[0] = _impl_H_ZIG_EXP_V / f;
+        _impl_h_zig_exp_x[1] = _impl_H_ZIG_EXP_R;
+        _impl_h_zig_exp_x[_impl_H_ZIG_EXP_LAYERS] = 0.0;
+        for (int i=2;i<_impl_H_ZIG_EXP_LAYERS;++i) {
+            _impl_h_zig_exp_x[i] = -log(_impl_H_ZIG_EXP_V / _impl_h_zig_exp_x[i - 1] + f);
+            f = exp(-_impl_h_zig_exp_x[i]);
+        }
+        for (int i=0;i<_impl_H_ZIG_EXP_LAYERS;++i)
+            _impl_h_zig_exp_r[i] = _impl_h_zig_exp_x[i + 1] / _impl_h_zig_exp_x[i];
+    }
+
+    // open interval (0, 1), safe to pass to log
+    static inline f64 _impl_h_rng_open_f64(h_rng_t *rng) {
+        return ((f64)(h_rng_next_u64(rng) >> 12) + 0.5) * 0x1.0p-52;
+    }
+
+    static f64 _impl_h_rng_std_normal(h_rng_t *rng) {
+        for (;;) {
+            // low 7 bits pick the layer, the top 53 bits give u in [-1, 1)
+            u64 bits = h_rng_next_u64(rng);
+            int i = (int)(bits & (_impl_H_ZIG_NORMAL_LAYERS - 1));
+            f64 u = (f64)(bits >> 11) * 0x1.0p-52 - 1.0;
+
+            if (fabs(u) < _impl_h_zig_normal_r[i]) return u * _impl_h_zig_normal_x[i];
+
+            if (i == 0) {
+                f64 x, y;
+                do {
+                    x = -log(_impl_h_rng_open_f64(rng)) / _impl_H_ZIG_NORMAL_R;
+                    y = -log(_impl_h_rng_open_f64(rng));
+                } while (y + y < x * x);
+                return u < 0 ? -(_impl_H_ZIG_NORMAL_R + x) : _impl_H_ZIG_NORMAL_R + x;
+            }
+
+            f64 x = u * _impl_h_zig_normal_x[i];
+            f64 f0 = exp(-0.5 * (_impl_h_zig_normal_x[i] * _impl_h_zig_normal_x[i] - x * x));
+            f64 f1 = exp(-0.5 * (_impl_h_zig_normal_x[i + 1] * _impl_h_zig_normal_x[i + 1] - x * x));
+            if (f1 + h_rng_next_f64(rng) * (f0 - f1) < 1.0) return x;
+        }
+    }
+
+    static f64 _impl_h_rng_std_exponential(h_rng_t *rng) {
+        for (;;) {
+            u64 bits = h_rng_next_u64(rng);
+            int i = (int)(bits & (_impl_H_ZIG_EXP_LAYERS - 1));
+            f64 u = (f64)(bits >> 11) * 0x1.0p-53;
+
+            if (u < _impl_h_zig_exp_r[i]) return u * _impl_h_zig_exp_x[i];
+
+            // memoryless tail
+            if (i == 0) return _impl_H_ZIG_EXP_R - log(_impl_h_rng_open_f64(rng));
+
+            f64 x = u * _impl_h_zig_exp_x[i];
+            f64 f0 = exp(x - _impl_h_zig_exp_x[i]);
+            f64 f1 = exp(x - _impl_h_zig_exp_x[i + 1]);
+            if (f1 + h_rng_next_f64(rng) * (f0 - f1) < 1.0) return x;
+        }
+    }
+
+    f64 h_rng_normal(h_rng_t *rng, f64 mean, f64 stddev) {
+        return mean + stddev * _impl_h_rng_std_normal(rng);
+    }
+    f64 h_rng_exponential(h_rng_t *rng, f64 rate) {
+        return _impl_h_rng_std_exponential(rng) / rate;
+    }
+
+    // Poisson : multiplication method for small lambda, Hormann's PTRS rejection above
+
+    typedef struct _impl_h_poisson_t {
+        f64 lambda, exp_neg_lambda, log_lambda, a, b, inv_alpha, vr;
+    } _impl_h_poisson_t;
+
+    static _impl_h_poisson_t _impl_h_poisson_setup(f64 lambda) {
+        _impl_h_poisson_t p = {lambda, exp(-lambda), log(lambda), 0, 0, 0, 0};
+        if (lambda >= 10.0) {
+            p.b = 0.931 + 2.53 * sqrt(lambda);
+            p.a = -0.059 + 0.02483 * p.b;
+            p.inv_alpha = 1.1239 + 1.1328 / (p.b - 3.4);
+            p.vr = 0.9277 - 3.6224 / (p.b - 2.0);
+        }
+        return p;
+    }
+
+    static u32 _impl_h_rng_poisson(h_rng_t *rng, _impl_h_poisson_t const *p) {
+        if (p->lambda <= 0.0) return 0;
+
+        if (p->lambda < 10.0) {
+            u32 k = 0;
+            f64 prod = h_rng_next_f64(rng);
+            while (prod > p->exp_neg_lambda) {
+                k++;
+                prod *= h_rng_next_f64(rng);
+            }
+            return k;
+        }
+
+        for (;;) {
+            f64 u = h_rng_next_f64(rng) - 0.5;
+            f64 v = _impl_h_rng_open_f64(rng);
+            f64 us = 0.5 - fabs(u);
+            f64 k = floor((2.0 * p->a / us + p->b) * u + p->lambda + 0.43);
+
+            if (us >= 0.07 && v <= p->vr) return (u32)k;
+            if (k < 0.0 || (us < 0.013 && v > us)) continue;
+            if (log(v) + log(p->inv_alpha) - log(p->a / (us * us) + p->b) <= -p->lambda + k * p->log_lambda - lgamma(k + 1.0))
+                return (u32)k;
+        }
+    }
+
+    u32 h_rng_poisson(h_rng_t *rng, f64 lambda) {
+        _impl_h_poisson_t p = _impl_h_poisson_setup(lambda);
+        return _impl_h_rng_poisson(rng, &p);
+    }
+
+    void h_rng_fill_normal(h_rng_t *rng, f64 *out, size_t n, f64 mean, f64 stddev) {
+        for (size_t i=0;i<n;++i) out[i] = mean + stddev * _impl_h_rng_std_normal(rng);
+    }
+    void h_rng_fill_exponential(h_rng_t *rng, f64 *out, size_t n, f64 rate) {
+        f64 scale = 1.0 / rate;
+        for (size_t i=0;i<n;++i) out[i] = _impl_h_rng_std_exponential(rng) * scale;
+    }
+    void h_rng_fill_poisson(h_rng_t *rng, u32 *out, size_t n, f64 lambda) {
+        _impl_h_poisson_t p = _impl_h_poisson_setup(lambda);
+        for (size_t i=0;i<n;++i) out[i] = _impl_h_rng_poisson(rng, &p);
+    }
+
+    // Alias table
+
+    h_alias_table_t h_create_alias_table(f64 const *weights, size_t n) {
+        if (!n || n > UINT32_MAX) return (h_alias_table_t){0};
+
+        f64 total = 0.0;
+        for (size_t i=0;i<n;++i) total += weights[i];
+        if (total <= 0.0) return (h_alias_table_t){0};
+
+        h_alias_table_t table = {n, malloc(n * sizeof(f64)), malloc(n * sizeof(u32))};
+        u32 *worklist = malloc(n * sizeof(u32));
+        if (!table.prob || !table.alias || !worklist) {
+            free(worklist);
+            h_alias_table_free(&table);
+            return (h_alias_table_t){0};
+        }
+
+        // small entries fill the worklist from the front, large ones from the back
+        size_t nsmall = 0, large = n;
+        for (size_t i=0;i<n;++i) {
+            table.prob[i] = weights[i] * (f64)n / total;
+            table.alias[i] = (u32)i;
+            if (table.prob[i] < 1.0) worklist[nsmall++] = (u32)i;
+            else worklist[--large] = (u32)i;
+        }
+
+        while (nsmall && large < n) {
+            u32 s = worklist[--nsmall];
+            u32 l = worklist[large];
+            table.alias[s] = l;
+            table.prob[l] -= 1.0 - table.prob[s];
+            if (table.prob[l] < 1.0) {
+                large++;
+                worklist[nsmall++] = l;
+            }
+        }
+        // leftovers are 1 up to rounding
+        while (nsmall) table.prob[worklist[--nsmall]] = 1.0;
+        while (large < n) table.prob[worklist[large++]] = 1.0;
+
+        free(worklist);
+        return table;
+    }
+    u32 h_alias_sample(h_alias_table_t const *table, h_rng_t *rng) {
+        f64 u = h_rng_next_f64(rng) * (f64)table->n;
+        u32 i = (u32)u;
+        return (u - (f64)i) < table->prob[i] ? i : table->alias[i];
+    }
+    void h_alias_fill(h_alias_table_t const *table, h_rng_t *rng, u32 *out, size_t n) {
+        for (size_t i=0;i<n;++i) out[i] = h_alias_sample(table, rng);
+    }
+    void h_alias_table_free(h_alias_table_t *table) {
+        free(table->prob);
+        free(table->alias);
+        table->prob = NULL;
+        table->alias = NULL;
+        table->n = 0;
+    }
+#endif
+
+#ifdef H_STRING
+
+    h_string_t h_tostring(h_cstr_t cstr) {
+        return (h_string_t){cstr, cstr?strlen(cstr):0};
+    }
+    h_cstr_t h_cstr(h_string_t str) {
+        return str.cstr;
+    }
+
+    h_array_t h_split_string(h_string_t str, char delim) {
+        char sdelim[2] = {delim, 0};
+        char *buffer = strdup(h_cstr(str));  // strtok modifie la string
+        if (!buffer) return (h_array_t){0};
+
+        h_array_t tokens = H_CREATE_ARRAY(h_string_t, 8);
+        char *token = strtok(buffer, sdelim);
+
+        while (token) {
+            h_string_t t = h_tostring(strdup(token));
+            H_ARRAY_PUSH(h_string_t, tokens, t);
+            token = strtok(NULL, sdelim);
+        }
+
+        // marque la fin
+        H_ARRAY_PUSH(h_string_t, tokens, h_tostring(NULL));
+
+        free(buffer);
+        return tokens;
+    }
+
+    bool h_string_eq_ptr(void* a, void* b) {
+        h_string_t *str_a = (h_string_t*)a;
+        h_string_t *str_b = (h_string_t*)b;
+        return strcmp(str_a->cstr, str_b->cstr) == 0;
+    }
+
+    // String views
+
+    h_string_view_t h_string_view(h_string_t str) {
+        return (h_string_view_t){str.cstr, str.size};
+    }
+    h_string_view_t h_string_view_cstr(char const *cstr) {
+        return (h_string_view_t){cstr, cstr?strlen(cstr):0};
+    }
+    h_string_view_t h_string_view_sub(h_string_view_t view, size_t offset, size_t size) {
+        if (offset > view.size) offset = view.size;
+        if (size > view.size - offset) size = view.size - offset;
+        return (h_string_view_t){view.data + offset, size};
+    }
+    bool h_string_view_eq(h_string_view_t a, h_string_view_t b) {
+        return a.size == b.size && (a.data == b.data || memcmp(a.data, b.data, a.size) == 0);
+    }
+    h_string_t h_string_view_dup(h_string_view_t view) {
+        h_cstr_t cstr = malloc(view.size + 1);
+        if (!cstr) return h_tostring(NULL);
+        memcpy(cstr, view.data, view.size);
+        cstr[view.size] = 0;
+        return (h_string_t){cstr, view.size};
+    }
+
+    // Search, classification and validation kernels
+
+    size_t h_string_find(h_string_view_t haystack, h_string_view_t needle) {
+        size_t n = haystack.size, m = needle.size;
+        if (!m) return 0;
+        if (m > n) return H_STRING_NPOS;
+        if (m == 1) {
+            char const *p = memchr(haystack.data, needle.data[0], n);
+            return p ? (size_t)(p - haystack.data) : H_STRING_NPOS;
+        }
+
+        size_t i = 0;
+#ifdef __AVX2__
+        // compare the first and last needle bytes 32 positions at a time, memcmp the candidates
+        __m256i first = _mm256_set1_epi8(needle.data[0]);
+        __m256i last = _mm256_set1_epi8(needle.data[m - 1]);
+        for (;i+m-1+32<=n;i+=32) {
+            __m256i block_first = _mm256_loadu_si256((__m256i const*)(haystack.data + i));
+            __m256i block_last = _mm256_loadu_si256((__m256i const*)(haystack.data + i + m - 1));
+            u32 mask = (u32)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last)));
+            while (mask) {
+                size_t pos = i + __builtin_ctz(mask);
+                if (memcmp(haystack.data + pos + 1, needle.data + 1, m - 2) == 0) return pos;
+                mask &= mask - 1;
+            }
+        }
+#endif
+        while (i + m <= n) {
+            char const *p = memchr(haystack.data + i, needle.data[0], n - m + 1 - i);
+            if (!p) return H_STRING_NPOS;
+            size_t pos = p - haystack.data;
+            if (memcmp(p + 1, needle.data + 1, m - 1) == 0) return pos;
+            i = pos + 1;
+        }
+        return H_STRING_NPOS;
+    }
+
+    size_t h_string_find_any(h_string_view_t str, h_string_view_t set) {
+        if (!set.size) return H_STRING_NPOS;
+        if (set.size == 1) {
+            char const *p = memchr(str.data, set.data[0], str.size);
+            return p ? (size_t)(p - str.data) : H_STRING_NPOS;
+        }
+
+        size_t i = 0;
+#if defined(__AVX2__)
+        if (set.size <= 8) {
+            __m256i needles[8];
+            for (size_t k=0;k<set.size;++k) needles[k] = _mm256_set1_epi8(set.data[k]);
+            for (;i+32<=str.size;i+=32) {
+                __m256i block = _mm256_loadu_si256((__m256i const*)(str.data + i));
+                __m256i hits = _mm256_cmpeq_epi8(block, needles[0]);
+                for (size_t k=1;k<set.size;++k) hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, needles[k]));
+                u32 mask = (u32)_mm256_movemask_epi8(hits);
+                if (mask) return i + __builtin_ctz(mask);
+            }
+        }
+#endif
+#if defined(__SSE4_2__)
+        if (set.size <= 16) {
+            char setbuf[16] = {0};
+            memcpy(setbuf, set.data, set.size);
+            __m128i needles = _mm_loadu_si128((__m128i const*)setbuf);
+            for (;i+16<=str.size;i+=16) {
+                __m128i block = _mm_loadu_si128((__m128i const*)(str.data + i));
+                int idx = _mm_cmpestri(needles, (int)set.size, block, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+                if (idx < 16) return i + idx;
+            }
+        }
+#endif
+        bool table[256] = {0};
+        for (size_t k=0;k<set.size;++k) table[(unsigned char)set.data[k]] = true;
+        for (;i<str.size;++i)
+            if (table[(unsigned char)str.data[i]]) return i;
+        return H_STRING_NPOS;
+    }
+
+    size_t h_string_count_char(h_string_view_t str, char c) {
+        size_t count = 0, i = 0;
+#ifdef __AVX2__
+        // matches are -1 per byte, summed in u8 lanes and flushed to u64 lanes before they can wrap
+        __m256i needle = _mm256_set1_epi8(c);
+        __m256i total = _mm256_setzero_si256();
+        while (i + 32 <= str.size) {
+            __m256i acc = _mm256_setzero_si256();
+            for (int k=0;k<255 && i+32<=str.size;++k,i+=32) {
+                __m256i block = _mm256_loadu_si256((__m256i const*)(str.data + i));
+                acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(block, needle));
+            }
+            total = _mm256_add_epi64(total, _mm256_sad_epu8(acc, _mm256_setzero_si256()));
+        }
+        count = (size_t)_mm256_extract_epi64(total, 0) + (size_t)_mm256_extract_epi64(total, 1)
+              + (size_t)_mm256_extract_epi64(total, 2) + (size_t)_mm256_extract_epi64(total, 3);
+#endif
+        for (;i<str.size;++i) count += str.data[i] == c;
+        return count;
+    }
+
+    // flips bit 5 of every byte in [first, first + 25]
+    static void _impl_h_string_flip_case(h_string_t str, char first) {
+        size_t i = 0;
+#ifdef __AVX2__
+        __m256i base = _mm256_set1_epi8(first);
+        __m256i span = _mm256_set1_epi8(25);
+        __m256i bit = _mm256_set1_epi8(0x20);
+        for (;i+32<=str.size;i+=32) {
+            __m256i block = _mm256_loadu_si256((__m256i const*)(str.cstr + i));
+            __m256i offset = _mm256_sub_epi8(block, base);
+            __m256i in_range = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, span), offset);
+            _mm256_storeu_si256((__m256i*)(str.cstr + i), _mm256_xor_si256(block, _mm256_and_si256(in_range, bit)));
+        }
+#endif
+        for (;i<str.size;++i)
+            if ((unsigned char)(str.cstr[i] - first) < 26) str.cstr[i] ^= 0x20;
+    }
+    void h_string_to_lower(h_string_t str) {
+        _impl_h_string_flip_case(str, 'A');
+    }
+    void h_string_to_upper(h_string_t str) {
+        _impl_h_string_flip_case(str, 'a');
+    }
+
+    static inline unsigned char _impl_h_ascii_lower(unsigned char c) {
+        return (unsigned char)(c - 'A') < 26 ? c | 0x20 : c;
+    }
+
+    int h_string_casecmp(h_string_view_t a, h_string_view_t b) {
+        size_t n = a.size < b.size ? a.size : b.size;
+        size_t i = 0;
+#ifdef __AVX2__
+        __m256i base = _mm256_set1_epi8('A');
+        __m256i span = _mm256_set1_epi8(25);
+        __m256i bit = _mm256_set1_epi8(0x20);
+        for (;i+32<=n;i+=32) {
+            __m256i va = _mm256_loadu_si256((__m256i const*)(a.data + i));
+            __m256i vb = _mm256_loadu_si256((__m256i const*)(b.data + i));
+            __m256i oa = _mm256_sub_epi8(va, base), ob = _mm256_sub_epi8(vb, base);
+            va = _mm256_or_si256(va, _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(oa, span), oa), bit));
+            vb = _mm256_or_si256(vb, _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(ob, span), ob), bit));
+            u32 eq = (u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+            if (eq != 0xFFFFFFFFu) {
+                i += __builtin_ctz(~eq);
+                break;
+            }
+        }
+#endif
+        for (;i<n;++i) {
+            unsigned char ca = _impl_h_ascii_lower((unsigned char)a.data[i]);
+            unsigned char cb = _impl_h_ascii_lower((unsigned char)b.data[i]);
+            if (ca != cb) return ca < cb ? -1 : 1;
+        }
+        return a.size == b.size ? 0 : (a.size < b.size ? -1 : 1);
+    }
+
+#ifndef __AVX2__
+    static bool _impl_h_utf8_validate_scalar(unsigned char const *s, size_t n) {
+        size_t i = 0;
+        while (i < n) {
+            // ASCII runs 8 bytes at a time
+            if (i + 8 <= n) {
+                u64 w;
+                memcpy(&w, s + i, 8);
+                if (!(w & 0x8080808080808080ull)) {
+                    i += 8;
+                    continue;
+                }
+            }
+            unsigned char c = s[i];
+            if (c < 0x80) {
+                i++;
+                continue;
+            }
+
+            size_t len;
+            u32 cp;
+            if (c >= 0xC2 && c <= 0xDF) { len = 2; cp = c & 0x1F; }
+            else if ((c & 0xF0) == 0xE0) { len = 3; cp = c & 0x0F; }
+            else if (c >= 0xF0 && c <= 0xF4) { len = 4; cp = c & 0x07; }
+            else return false;
+
+            if (i + len > n) return false;
+            for (size_t k=1;k<len;++k) {
+                if ((s[i + k] & 0xC0) != 0x80) return false;
+                cp = (cp << 6) | (s[i + k] & 0x3F);
+            }
+            if (len == 3 && (cp < 0x800 || (cp >= 0xD800 && cp <= 0xDFFF))) return false;
+            if (len == 4 && (cp < 0x10000 || cp > 0x10FFFF)) return false;
+            i += len;
+        }
+        return true;
+    }
+#else
+    // Keiser & Lemire lookup validation : three nibble lookups flag every invalid two byte pattern,
+    // and 3rd/4th continuation bytes are checked against the lead bytes 2 and 3 positions back.
+
+    enum {
+        _impl_H_UTF8_TOO_SHORT = 1 << 0,
+        _impl_H_UTF8_TOO_LONG = 1 << 1,
+        _impl_H_UTF8_OVERLONG_3 = 1 << 2,
+        _impl_H_UTF8_TOO_LARGE = 1 << 3,
+        _impl_H_UTF8_SURROGATE = 1 << 4,
+        _impl_H_UTF8_OVERLONG_2 = 1 << 5,
+        _impl_H_UTF8_TOO_LARGE_1000 = 1 << 6,
+        _impl_H_UTF8_OVERLONG_4 = 1 << 6,
+        _impl_H_UTF8_TWO_CONTS = 1 << 7,
+        _impl_H_UTF8_CARRY = _impl_H_UTF8_TOO_SHORT | _impl_H_UTF8_TOO_LONG | _impl_H_UTF8_TWO_CONTS,
+    };
+
+#define _impl_H_UTF8_TABLE(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+#define _impl_H_UTF8_PREV(input, prev, n) _mm256_alignr_epi8((input), _mm256_permute2x128_si256((prev), (input), 0x21), 16 - (n))
+
+    static inline __m256i _impl_h_utf8_check_block(__m256i input, __m256i prev_input) {
+        enum {
+            TS = _impl_H_UTF8_TOO_SHORT, TL = _impl_H_UTF8_TOO_LONG, O3 = _impl_H_UTF8_OVERLONG_3,
+            LG = _impl_H_UTF8_TOO_LARGE, SG = _impl_H_UTF8_SURROGATE, O2 = _impl_H_UTF8_OVERLONG_2,
+            L1 = _impl_H_UTF8_TOO_LARGE_1000, O4 = _impl_H_UTF8_OVERLONG_4, TC = _impl_H_UTF8_TWO_CONTS,
+            CA = _impl_H_UTF8_CARRY,
+        };
+        __m256i const byte_1_high_table = _impl_H_UTF8_TABLE(
+            TL, TL, TL, TL, TL, TL, TL, TL,
+            TC, TC, TC, TC,
+            TS | O2, TS, TS | O3 | SG, (char)(TS | LG | L1 | O4));
+        __m256i const byte_1_low_table = _impl_H_UTF8_TABLE(
+            (char)(CA | O3 | O2 | O4), (char)(CA | O2), (char)CA, (char)CA,
+            (char)(CA | LG), (char)(CA | LG | L1), (char)(CA | LG | L1), (char)(CA | LG | L1),
+            (char)(CA | LG | L1), (char)(CA | LG | L1), (char)(CA | LG | L1), (char)(CA | LG | L1),
+            (char)(CA | LG | L1), (char)(CA | LG | L1 | SG), (char)(CA | LG | L1), (char)(CA | LG | L1));
+        __m256i const byte_2_high_table = _impl_H_UTF8_TABLE(
+            TS, TS, TS, TS, TS, TS, TS, TS,
+            (char)(TL | O2 | TC | O3 | L1 | O4), (char)(TL | O2 | TC | O3 | LG),
+            (char)(TL | O2 | TC | SG | LG), (char)(TL | O2 | TC | SG | LG),
+            TS, TS, TS, TS);
+
+        __m256i nibble = _mm256_set1_epi8(0x0F);
+        __m256i prev1 = _impl_H_UTF8_PREV(input, prev_input, 1);
+        __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+        __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, nibble));
+        __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+        __m256i special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+        // only 111xxxxx two back and 1111xxxx three back keep their top bit after the subtraction
+        __m256i prev2 = _impl_H_UTF8_PREV(input, prev_input, 2);
+        __m256i prev3 = _impl_H_UTF8_PREV(input, prev_input, 3);
+        __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+        __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+        __m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+        return _mm256_xor_si256(must23, special);
+    }
+#endif
+
+    bool h_utf8_validate(h_string_view_t str) {
+#ifdef __AVX2__
+        __m256i error = _mm256_setzero_si256();
+        __m256i prev = _mm256_setzero_si256();
+        size_t i = 0;
+        for (;i+32<=str.size;i+=32) {
+            __m256i input = _mm256_loadu_si256((__m256i const*)(str.data + i));
+            error = _mm256_or_si256(error, _impl_h_utf8_check_block(input, prev));
+            prev = input;
+        }
+        // the zero padded tail also flags a sequence cut short by the end of the input
+        char tail[32] = {0};
+        if (str.size > i) memcpy(tail, str.data + i, str.size - i);
+        error = _mm256_or_si256(error, _impl_h_utf8_check_block(_mm256_loadu_si256((__m256i const*)tail), prev));
+        return _mm256_testz_si256(error, error);
+#else
+        return _impl_h_utf8_validate_scalar((unsigned char const*)str.data, str.size);
+#endif
+    }
+
+    h_array_t h_split_view(h_string_view_t str, char delim) {
+        // count first so the array is allocated exactly once
+        size_t nfields = 1;
+        char const *end = str.data + str.size;
+        for (char const *p = str.data; p && p < end; ++nfields) {
+            p = memchr(p, delim, end - p);
+            if (!p) break;
+            p++;
+        }
+
+        h_array_t fields = H_CREATE_ARRAY(h_string_view_t, nfields);
+        if (!fields.data) return (h_array_t){0};
+
+        h_split_iter_t split = h_split_iter(str, delim);
+        h_string_view_t *out = fields.data;
+        while (h_split_next(&split, &out[fields.size])) fields.size++;
+        return fields;
+    }
+
+    h_split_iter_t h_split_iter(h_string_view_t str, char delim) {
+        return (h_split_iter_t){str.data, str.data + str.size, delim, false, {str.data, 0}};
+    }
+    bool h_split_next(h_split_iter_t *split, h_string_view_t *out) {
+        if (split->done) return false;
+
+        char const *found = split->pos ? memchr(split->pos, split->delim, split->end - split->pos) : NULL;
+        if (!found) {
+            // last field runs to the end of the buffer
+            *out = (h_string_view_t){split->pos, split->end - split->pos};
+            split->done = true;
+            return true;
+        }
+        *out = (h_string_view_t){split->pos, found - split->pos};
+        split->pos = found + 1;
+        return true;
+    }
+
+    size_t h_split_fields(h_string_view_t record, char delim, h_string_view_t *out, size_t max) {
+        if (!max) return 0;
+        size_t nfields = 0, start = 0, i = 0;
+#ifdef __AVX2__
+        __m256i needle = _mm256_set1_epi8(delim);
+        for (;i+32<=record.size;i+=32) {
+            u32 mask = (u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const*)(record.data + i)), needle));
+            while (mask) {
+                size_t pos = i + __builtin_ctz(mask);
+                out[nfields++] = (h_string_view_t){record.data + start, pos - start};
+                if (nfields == max) return nfields;
+                start = pos + 1;
+                mask &= mask - 1;
+            }
+        }
+#endif
+        char const *end = record.data + record.size;
+        char const *p = record.data + i;
+        while (p && p < end && (p = memchr(p, delim, end - p))) {
+            size_t pos = p - record.data;
+            out[nfields++] = (h_string_view_t){record.data + start, pos - start};
+            if (nfields == max) return nfields;
+            start = pos + 1;
+            p++;
+        }
+        out[nfields++] = (h_string_view_t){record.data + start, record.size - start};
+        return nfields;
+    }
+
+#ifdef H_ALLOCATORS
+    h_string_t h_arena_string_alloc_cstr(h_linear_allocator_t *arena, char *cstr) {
+        size_t size = strlen(cstr) + 1;
+        h_cstr_t cstr_ptr = h_linear_alloc(arena, size);
+        memcpy(cstr_ptr, cstr, size);
+        return (h_string_t){cstr_ptr, size};
+
+    }
+    h_string_t h_arena_string_alloc_size(h_linear_allocator_t *arena, size_t size) {
+        h_cstr_t cstr_ptr = h_linear_alloc(arena, size);
+        return (h_string_t){cstr_ptr, size};
+    }
+
+    // String interning
+    // slots is an open addressed (linear probing) table of id + 1, 0 marks an empty slot.
+    // It doubles at 50% load, which h_hashmap_t's fixed bucket count can't do.
+
+    h_interner_t h_create_interner(size_t expected) {
+        if (expected < 16) expected = 16;
+        size_t nslots = 32;
+        while (nslots < expected * 2) nslots *= 2;
+
+        h_interner_t interner = {
+            h_arena_create("Interner"),
+            0,
+            H_CREATE_ARRAY(h_intern_entry_t, expected),
+            calloc(nslots, sizeof(u32)),
+            nslots
+        };
+        if (!interner.arena || !interner.entries.data || !interner.slots) h_interner_free(&interner);
+        return interner;
+    }
+
+    static bool _impl_h_interner_probe(h_interner_t const *interner, h_string_view_t str, u32 hash, size_t *out_slot) {
+        h_intern_entry_t const *entries = interner->entries.data;
+        size_t mask = interner->nslots - 1;
+        for (size_t slot = hash & mask;;slot = (slot + 1) & mask) {
+            u32 id = interner->slots[slot];
+            if (!id) {
+                *out_slot = slot;
+                return false;
+            }
+            h_intern_entry_t const *e = &entries[id - 1];
+            if (e->hash == hash && e->size == str.size && memcmp(e->data, str.data, str.size) == 0) {
+                *out_slot = slot;
+                return true;
+            }
+        }
+    }
+
+    static bool _impl_h_interner_grow(h_interner_t *interner) {
+        size_t nslots = interner->nslots * 2;
+        u32 *slots = calloc(nslots, sizeof(u32));
+        if (!slots) return false;
+        h_intern_entry_t const *entries = interner->entries.data;
+        for (size_t id=0;id<interner->entries.size;++id) {
+            size_t slot = entries[id].hash & (nslots - 1);
+            while (slots[slot]) slot = (slot + 1) & (nslots - 1);
+            slots[slot] = (u32)id + 1;
+        }
+        free(interner->slots);
+        interner->slots = slots;
+        interner->nslots = nslots;
+        return true;
+    }
+
+    bool h_interner_find(h_interner_t const *interner, h_string_view_t str, u32 *out_id) {
+        size_t slot;
+        if (!interner->slots) return false;
+        if (!_impl_h_interner_probe(interner, str, h_hash_bytes(str.data, str.size), &slot)) return false;
+        *out_id = interner->slots[slot] - 1;
+        return true;
+    }
+    u32 h_intern(h_interner_t *interner, h_string_view_t str) {
+        if (!interner->slots) return H_INTERN_FAILED;
+        u32 hash = h_hash_bytes(str.data, str.size);
+        size_t slot;
+        if (_impl_h_interner_probe(interner, str, hash, &slot)) return interner->slots[slot] - 1;
+        if (interner->entries.size >= H_INTERN_FAILED - 1 || str.size > UINT32_MAX) return H_INTERN_FAILED;
+
+        // every allocation happens before the first write, a failure leaves the interner unchanged
+        h_array_t *entries = &interner->entries;
+        if (entries->size == entries->cap) {
+            size_t cap = entries->cap ? entries->cap * 2 : 16;
+            void *grown = realloc(entries->data, cap * entries->el_size);
+            if (!grown) return H_INTERN_FAILED;
+            entries->data = grown;
+            entries->cap = cap;
+        }
+        if ((entries->size + 1) * 2 > interner->nslots) {
+            if (!_impl_h_interner_grow(interner)) return H_INTERN_FAILED;
+            _impl_h_interner_probe(interner, str, hash, &slot);
+        }
+        char *data = h_arena_alloc(interner->arena, str.size + 1);
+        if (!data) return H_INTERN_FAILED;
+
+        memcpy(data, str.data, str.size);
+        data[str.size] = 0;
+        interner->string_bytes += str.size + 1;
+
+        u32 id = (u32)entries->size;
+        h_intern_entry_t entry = {data, (u32)str.size, hash};
+        h_array_push(entries, &entry);
+        interner->slots[slot] = id + 1;
+        return id;
+    }
+    h_string_view_t h_interner_lookup(h_interner_t const *interner, u32 id) {
+        if (id >= interner->entries.size) return (h_string_view_t){NULL, 0};
+        h_intern_entry_t const *e = &((h_intern_entry_t const*)interner->entries.data)[id];
+        return (h_string_view_t){e->data, e->size};
+    }
+    u32 h_interner_hash(h_interner_t const *interner, u32 id) {
+        if (id >= interner->entries.size) return 0;
+        return ((h_intern_entry_t const*)interner->entries.data)[id].hash;
+    }
+    size_t h_interner_count(h_interner_t const *interner) {
+        return interner->entries.size;
+    }
+    size_t h_interner_memory(h_interner_t const *interner) {
+        // arena block slack isn't counted
+        return sizeof(h_interner_t) + interner->string_bytes
+            + interner->entries.cap * interner->entries.el_size
+            + interner->nslots * sizeof(u32);
+    }
+    void h_interner_free(h_interner_t *interner) {
+        if (interner->arena) h_arena_destroy(interner->arena);
+        h_array_free(&interner->entries);
+        free(interner->slots);
+        *interner = (h_interner_t){0};
+    }
+
+    u32 h_symbol_hash_ptr(void *pair) {
+        return h_pcg_hash(*(u32*)pair);
+    }
+    bool h_symbol_eq_ptr(void *a, void *b) {
+        return *(u32*)a == *(u32*)b;
+    }
+
+    // Small string optimized string
+
+    static h_sso_string_t _impl_h_sso_create(h_arena_t *arena, h_string_view_t str) {
+        h_sso_string_t sso;
+        memset(&sso, 0, sizeof(sso));
+        if (str.size <= H_SSO_CAPACITY) {
+            if (str.size) memcpy(sso.small, str.data, str.size);
+            sso.small[H_SSO_CAPACITY] = (char)(H_SSO_CAPACITY - str.size);
+            return sso;
+        }
+
+        char *data = arena ? h_arena_alloc(arena, str.size + 1) : malloc(str.size + 1);
+        if (!data) {
+            // large, not owned, NULL data and size 0
+            sso.small[H_SSO_CAPACITY] = (char)_impl_H_SSO_LARGE;
+            return sso;
+        }
+        memcpy(data, str.data, str.size);
+        data[str.size] = 0;
+        sso.large.data = data;
+        sso.large.size = str.size;
+        sso.small[H_SSO_CAPACITY] = (char)(_impl_H_SSO_LARGE | (arena ? 0 : _impl_H_SSO_OWNED));
+        return sso;
+    }
+
+    h_sso_string_t h_sso_from_view(h_string_view_t str) {
+        return _impl_h_sso_create(NULL, str);
+    }
+    h_sso_string_t h_sso_from_view_arena(h_arena_t *arena, h_string_view_t str) {
+        return _impl_h_sso_create(arena, str);
+    }
+    h_sso_string_t h_sso_from_string(h_string_t str) {
+        return _impl_h_sso_create(NULL, h_string_view(str));
+    }
+
+    bool h_sso_is_inline(h_sso_string_t const *str) {
+        return !(str->small[H_SSO_CAPACITY] & _impl_H_SSO_LARGE);
+    }
+    bool h_sso_ok(h_sso_string_t const *str) {
+        return h_sso_is_inline(str) || str->large.data != NULL;
+    }
+    size_t h_sso_size(h_sso_string_t const *str) {
+        return h_sso_is_inline(str) ? H_SSO_CAPACITY - (size_t)str->small[H_SSO_CAPACITY] : str->large.size;
+    }
+    char const *h_sso_cstr(h_sso_string_t const *str) {
+        return h_sso_is_inline(str) ? str->small : str->large.data;
+    }
+    h_string_view_t h_sso_view(h_sso_string_t const *str) {
+        return (h_string_view_t){h_sso_cstr(str), h_sso_size(str)};
+    }
+    h_string_t h_sso_to_string(h_sso_string_t *str) {
+        return (h_string_t){h_sso_is_inline(str) ? str->small : str->large.data, h_sso_size(str)};
+    }
+
+    bool h_sso_eq(h_sso_string_t const *a, h_sso_string_t const *b) {
+        if (h_sso_is_inline(a)) return memcmp(a, b, sizeof(h_sso_string_t)) == 0;
+        // a string that fits inline is always stored inline, so mixed modes never compare equal
+        return !h_sso_is_inline(b) && a->large.data && b->large.data && a->large.size == b->large.size
+            && memcmp(a->large.data, b->large.data, a->large.size) == 0;
+    }
+    u32 h_sso_hash(h_sso_string_t const *str) {
+        if (h_sso_is_inline(str)) return h_hash_bytes(str->small, sizeof(str->small));
+        return h_hash_bytes(str->large.data, str->large.size);
+    }
+    void h_sso_free(h_sso_string_t *str) {
+        if (str->small[H_SSO_CAPACITY] & _impl_H_SSO_OWNED) free(str->large.data);
+        memset(str, 0, sizeof(*str));
+        str->small[H_SSO_CAPACITY] = H_SSO_CAPACITY;
+    }
+
+    u32 h_sso_hash_ptr(void *pair) {
+        return h_sso_hash((h_sso_string_t const*)pair);
+    }
+    bool h_sso_eq_ptr(void *a, void *b) {
+        return h_sso_eq((h_sso_string_t const*)a, (h_sso_string_t const*)b);
+    }
+
+    // String builder
+
+    static bool _impl_h_string_builder_grow(h_string_builder_t *sb, size_t min_cap) {
+        size_t cap = sb->cap ? sb->cap : 64;
+        while (cap < min_cap) cap *= 2;
+
+        switch (sb->backing) {
+            case H_STRING_BUILDER_HEAP: {
+                char *data = realloc(sb->data, cap);
+                if (!data) return false;
+                sb->data = data;
+                break;
+            }
+            case H_STRING_BUILDER_ARENA: {
+                h_arena_t *arena = (h_arena_t*)sb->allocator;
+                if (sb->data && (char*)arena->end == sb->data + sb->cap && sb->data + cap <= (char*)arena->limit) {
+                    arena->end = sb->data + cap;
+                    break;
+                }
+                char *data = h_arena_alloc(arena, cap);
+                if (!data) return false;
+                if (sb->size) memcpy(data, sb->data, sb->size);
+                sb->data = data;
+                break;
+            }
+            case H_STRING_BUILDER_LINEAR: {
+                h_linear_allocator_t *allocator = (h_linear_allocator_t*)sb->allocator;
+                if (sb->data && (char*)allocator->data + allocator->size == sb->data + sb->cap
+                    && allocator->size + (cap - sb->cap) <= allocator->cap) {
+                    allocator->size += cap - sb->cap;
+                    break;
+                }
+                char *data = h_linear_alloc(allocator, cap);
+                if (!data) return false;
+                if (sb->size) memcpy(data, sb->data, sb->size);
+                sb->data = data;
+                break;
+            }
+        }
+        sb->cap = cap;
+        return true;
+    }
+
+    static h_string_builder_t _impl_h_create_string_builder(h_string_builder_backing_t backing, void *allocator, size_t cap) {
+        h_string_builder_t sb = {NULL, 0, 0, backing, allocator};
+        if (cap) _impl_h_string_builder_grow(&sb, cap);
+        return sb;
     }
-    h_cstr_t h_cstr(h_string_t str) {
-        return str.cstr;
+    h_string_builder_t h_create_string_builder(size_t cap) {
+        return _impl_h_create_string_builder(H_STRING_BUILDER_HEAP, NULL, cap);
+    }
+    h_string_builder_t h_create_arena_string_builder(h_arena_t *arena, size_t cap) {
+        return _impl_h_create_string_builder(H_STRING_BUILDER_ARENA, arena, cap);
+    }
+    h_string_builder_t h_create_linear_string_builder(h_linear_allocator_t *allocator, size_t cap) {
+        return _impl_h_create_string_builder(H_STRING_BUILDER_LINEAR, allocator, cap);
     }
 
-    h_array_t h_split_string(h_string_t str, char delim) {
-        char sdelim[2] = {delim, 0};
-        char *buffer = strdup(h_cstr(str));  // strtok modifie la string
-        if (!buffer) return (h_array_t){0};
-
-        h_array_t tokens = H_CREATE_ARRAY(h_string_t, 8);
-        char *token = strtok(buffer, sdelim);
+    bool h_string_builder_reserve(h_string_builder_t *sb, size_t extra) {
+        if (sb->size + extra <= sb->cap) return true;
+        return _impl_h_string_builder_grow(sb, sb->size + extra);
+    }
+    bool h_string_builder_append(h_string_builder_t *sb, h_string_view_t str) {
+        if (!h_string_builder_reserve(sb, str.size)) return false;
+        memcpy(sb->data + sb->size, str.data, str.size);
+        sb->size += str.size;
+        return true;
+    }
+    bool h_string_builder_append_cstr(h_string_builder_t *sb, char const *cstr) {
+        return h_string_builder_append(sb, h_string_view_cstr(cstr));
+    }
+    bool h_string_builder_append_char(h_string_builder_t *sb, char c) {
+        if (!h_string_builder_reserve(sb, 1)) return false;
+        sb->data[sb->size++] = c;
+        return true;
+    }
 
-        while (token) {
-            h_string_t t = h_tostring(strdup(token));
-            H_ARRAY_PUSH(h_string_t, tokens, t);
-            token = strtok(NULL, sdelim);
+    static const char _impl_h_digit_pairs[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    // writes val right aligned ending at end, two digits per step, returns the first character
+    static char *_impl_h_format_u64(char *end, u64 val) {
+        while (val >= 100) {
+            end -= 2;
+            memcpy(end, &_impl_h_digit_pairs[(val % 100) * 2], 2);
+            val /= 100;
         }
+        if (val >= 10) {
+            end -= 2;
+            memcpy(end, &_impl_h_digit_pairs[val * 2], 2);
+        } else {
+            *--end = (char)('0' + val);
+        }
+        return end;
+    }
 
-        // marque la fin
-        H_ARRAY_PUSH(h_string_t, tokens, h_tostring(NULL));
-
-        free(buffer);
-        return tokens;
+    bool h_string_builder_append_u64(h_string_builder_t *sb, u64 val) {
+        char buf[20];
+        char *start = _impl_h_format_u64(buf + sizeof(buf), val);
+        return h_string_builder_append(sb, (h_string_view_t){start, (size_t)(buf + sizeof(buf) - start)});
+    }
+    bool h_string_builder_append_i64(h_string_builder_t *sb, i64 val) {
+        char buf[21];
+        u64 mag = val < 0 ? 0 - (u64)val : (u64)val;
+        char *start = _impl_h_format_u64(buf + sizeof(buf), mag);
+        if (val < 0) *--start = '-';
+        return h_string_builder_append(sb, (h_string_view_t){start, (size_t)(buf + sizeof(buf) - start)});
     }
+    bool h_string_builder_append_f64(h_string_builder_t *sb, f64 val, u32 decimals) {
+        static const u64 pow10[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+        if (isnan(val)) return h_string_builder_append_cstr(sb, "nan");
+        if (isinf(val)) return h_string_builder_append_cstr(sb, val < 0 ? "-inf" : "inf");
+
+        f64 mag = fabs(val);
+        if (mag >= 1e18 || decimals > 9) {
+            int n = snprintf(NULL, 0, "%.*f", (int)decimals, val);
+            if (n < 0 || !h_string_builder_reserve(sb, (size_t)n + 1)) return false;
+            snprintf(sb->data + sb->size, (size_t)n + 1, "%.*f", (int)decimals, val);
+            sb->size += (size_t)n;
+            return true;
+        }
 
-    bool h_string_eq_ptr(void* a, void* b) {
-        h_string_t *str_a = (h_string_t*)a;
-        h_string_t *str_b = (h_string_t*)b;
-        return strcmp(str_a->cstr, str_b->cstr) == 0;
+        // mag = mantissa * 2^exp exactly, scaled by 10^decimals in 128 bits (below 2^83)
+        // and rounded half to even on the shifted out bits, like printf
+        int exp;
+        u64 mantissa = (u64)ldexp(frexp(mag, &exp), 53);
+        exp -= 53;
+        unsigned __int128 scaled = (unsigned __int128)mantissa * pow10[decimals];
+        if (exp >= 0) scaled <<= exp;
+        else if (exp < -100) scaled = 0;    // below 2^-17, rounds to 0
+        else {
+            unsigned __int128 rest = scaled & ((((unsigned __int128)1) << -exp) - 1);
+            unsigned __int128 half = ((unsigned __int128)1) << (-exp - 1);
+            scaled >>= -exp;
+            if (rest > half || (rest == half && (scaled & 1))) scaled++;
+        }
+        u64 ipart = (u64)(scaled / pow10[decimals]);
+        u64 fpart = (u64)(scaled % pow10[decimals]);
+
+        char buf[32];
+        char *end = buf + sizeof(buf);
+        char *start = end;
+        if (decimals) {
+            start = _impl_h_format_u64(end, fpart);
+            while (end - start < (ptrdiff_t)decimals) *--start = '0';
+            *--start = '.';
+        }
+        start = _impl_h_format_u64(start, ipart);
+        if (signbit(val)) *--start = '-';
+        return h_string_builder_append(sb, (h_string_view_t){start, (size_t)(end - start)});
     }
 
-#ifdef H_ALLOCATORS
-    h_string_t h_arena_string_alloc_cstr(h_linear_allocator_t *arena, char *cstr) {
-        size_t size = strlen(cstr) + 1;
-        h_cstr_t cstr_ptr = h_linear_alloc(arena, size);
-        memcpy(cstr_ptr, cstr, size);
-        return (h_string_t){cstr_ptr, size};
+    h_string_view_t h_string_builder_view(h_string_builder_t const *sb) {
+        return (h_string_view_t){sb->data, sb->size};
+    }
+    void h_string_builder_clear(h_string_builder_t *sb) {
+        sb->size = 0;
+    }
+    h_string_t h_string_builder_finish(h_string_builder_t *sb) {
+        if (!h_string_builder_reserve(sb, 1)) return h_tostring(NULL);
+        sb->data[sb->size] = 0;
+        h_string_t str = {sb->data, sb->size};
+        *sb = (h_string_builder_t){NULL, 0, 0, sb->backing, sb->allocator};
+        return str;
+    }
+    void h_string_builder_free(h_string_builder_t *sb) {
+        if (sb->backing == H_STRING_BUILDER_HEAP) free(sb->data);
+        *sb = (h_string_builder_t){NULL, 0, 0, sb->backing, sb->allocator};
+    }
 
+    h_shared_interner_t *h_shared_interner_create(size_t expected) {
+        h_shared_interner_t *shared = calloc(1, sizeof(h_shared_interner_t));
+        if (!shared) return NULL;
+        shared->interner = h_create_interner(expected);
+        if (!shared->interner.arena || pthread_rwlock_init(&shared->lock, NULL) != 0) {
+            h_interner_free(&shared->interner);
+            free(shared);
+            return NULL;
+        }
+        return shared;
     }
-    h_string_t h_arena_string_alloc_size(h_linear_allocator_t *arena, size_t size) {
-        h_cstr_t cstr_ptr = h_linear_alloc(arena, size);
-        return (h_string_t){cstr_ptr, size};
+    u32 h_shared_intern(h_shared_interner_t *shared, h_string_view_t str) {
+        u32 id;
+        if (h_shared_interner_find(shared, str, &id)) return id;
+
+        pthread_rwlock_wrlock(&shared->lock);
+        id = h_intern(&shared->interner, str);
+        pthread_rwlock_unlock(&shared->lock);
+        return id;
+    }
+    bool h_shared_interner_find(h_shared_interner_t *shared, h_string_view_t str, u32 *out_id) {
+        pthread_rwlock_rdlock(&shared->lock);
+        bool found = h_interner_find(&shared->interner, str, out_id);
+        pthread_rwlock_unlock(&shared->lock);
+        return found;
+    }
+    h_string_view_t h_shared_interner_lookup(h_shared_interner_t *shared, u32 id) {
+        pthread_rwlock_rdlock(&shared->lock);
+        h_string_view_t view = h_interner_lookup(&shared->interner, id);
+        pthread_rwlock_unlock(&shared->lock);
+        return view;
+    }
+    void h_shared_interner_destroy(h_shared_interner_t *shared) {
+        pthread_rwlock_destroy(&shared->lock);
+        h_interner_free(&shared->interner);
+        free(shared);
     }
 
 #endif
@@ -847,6 +3600,35 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
         return (h_link_t*)iter->state != NULL;
     }
 
+    h_iter_t h_slot_map_iter(h_slot_map_t *map) {
+        return (h_iter_t){map, map->values, &h_slot_map_next, &h_slot_map_hasnext};
+    }
+    void *h_slot_map_next(h_iter_t *iter) {
+        h_slot_map_t *map = (h_slot_map_t*)iter->collection;
+        void *val = iter->state;
+        if (iter->hasnext(iter))
+            iter->state = (char*)iter->state + map->el_size;
+        return val;
+    }
+    bool h_slot_map_hasnext(h_iter_t *iter) {
+        h_slot_map_t *map = (h_slot_map_t*)iter->collection;
+        return (char*)iter->state < (char*)map->values + map->size * map->el_size;
+    }
+
+    h_iter_t h_sparse_set_iter(h_sparse_set_t *set) {
+        return (h_iter_t){set, set->dense, &h_sparse_set_next, &h_sparse_set_hasnext};
+    }
+    void *h_sparse_set_next(h_iter_t *iter) {
+        void *id = iter->state;
+        if (iter->hasnext(iter))
+            iter->state = (u32*)iter->state + 1;
+        return id;
+    }
+    bool h_sparse_set_hasnext(h_iter_t *iter) {
+        h_sparse_set_t *set = (h_sparse_set_t*)iter->collection;
+        return (u32*)iter->state < set->dense + set->size;
+    }
+
 #endif
 
 #ifdef H_BITSET
@@ -861,7 +3643,21 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
     }
     bool h_bitset_hasnext(h_iter_t *iter) {
         h_bitset_t *bitset = (h_bitset_t*)iter->collection;
-        return iter->state < bitset->words+bitset->size*sizeof(u64);
+        return (h_bitset_word_t*)iter->state < bitset->words + bitset->size;
+    }
+#endif
+
+#ifdef H_STRING
+    h_iter_t h_split_view_iter(h_split_iter_t *split) {
+        return (h_iter_t){split, &split->current, &h_split_view_next, &h_split_view_hasnext};
+    }
+    void *h_split_view_next(h_iter_t *iter) {
+        h_split_iter_t *split = (h_split_iter_t*)iter->collection;
+        if (!h_split_next(split, &split->current)) return NULL;
+        return &split->current;
+    }
+    bool h_split_view_hasnext(h_iter_t *iter) {
+        return !((h_split_iter_t*)iter->collection)->done;
     }
 #endif
 
@@ -873,6 +3669,16 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
         return (h_bitset_t){1, words};
     }
 
+    // grows to the next power of two holding word_idx, new words start cleared
+    static void _impl_h_bitset_fit(h_bitset_t *bitset, size_t word_idx) {
+        if (word_idx < bitset->size) return;
+        size_t size = bitset->size;
+        while (size <= word_idx) size *= 2;
+        bitset->words = realloc(bitset->words, size * sizeof(h_bitset_word_t));
+        memset(bitset->words + bitset->size, 0, (size - bitset->size) * sizeof(h_bitset_word_t));
+        bitset->size = size;
+    }
+
     void h_bitset_set(h_bitset_t *bitset, size_t idx) {
         if (bitset->size == 0 || bitset->words == NULL)
             return;
@@ -880,10 +3686,7 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
         h_bitset_word_t word_idx = idx / (sizeof(h_bitset_word_t) * 8);
         h_bitset_word_t bit_idx = idx % (sizeof(h_bitset_word_t) * 8);
 
-        if (word_idx >= bitset->size) {
-            bitset->size*=2;
-            bitset->words = realloc(bitset->words, bitset->size * sizeof(h_bitset_word_t));
-        }
+        _impl_h_bitset_fit(bitset, word_idx);
 
         bitset->words[word_idx] |= (1ULL << bit_idx);
     }
@@ -910,10 +3713,7 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
         h_bitset_word_t word_idx = idx / (sizeof(h_bitset_word_t) * 8);
         h_bitset_word_t bit_idx = idx % (sizeof(h_bitset_word_t) * 8);
 
-        if (word_idx >= bitset->size) {
-            bitset->size*=2;
-            bitset->words = realloc(bitset->words, bitset->size * sizeof(h_bitset_word_t));
-        }
+        _impl_h_bitset_fit(bitset, word_idx);
 
         bitset->words[word_idx] &= ~(1ULL << bit_idx);
     }
@@ -924,10 +3724,7 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
         h_bitset_word_t word_idx = idx / (sizeof(h_bitset_word_t) * 8);
         h_bitset_word_t bit_idx = idx % (sizeof(h_bitset_word_t) * 8);
 
-        if (word_idx >= bitset->size) {
-            bitset->size*=2;
-            bitset->words = realloc(bitset->words, bitset->size * sizeof(h_bitset_word_t));
-        }
+        _impl_h_bitset_fit(bitset, word_idx);
 
         bitset->words[word_idx] ^= (1ULL << bit_idx);
     }
@@ -986,6 +3783,590 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
         }
     }
 
+    // Atomic Bitset
+
+    // bits past nbits are kept set so claim never hands them out
+    static h_bitset_word_t _impl_h_atomic_bitset_padding(h_atomic_bitset_t const *bitset, size_t w) {
+        size_t first = w * _impl_H_BITSET_WORD_BITS;
+        if (first >= bitset->nbits) return ~0ULL;
+        if (bitset->nbits - first >= _impl_H_BITSET_WORD_BITS) return 0;
+        return ~0ULL << (bitset->nbits - first);
+    }
+
+    h_atomic_bitset_t h_create_atomic_bitset(size_t nbits) {
+        size_t nwords = (nbits + _impl_H_BITSET_WORD_BITS - 1) / _impl_H_BITSET_WORD_BITS;
+        nwords = (nwords + _impl_H_ATOMIC_BITSET_LINE_WORDS - 1) / _impl_H_ATOMIC_BITSET_LINE_WORDS * _impl_H_ATOMIC_BITSET_LINE_WORDS;
+        if (!nwords) return (h_atomic_bitset_t){0};
+
+        h_bitset_word_t *words = aligned_alloc(H_CACHE_LINE_SIZE, nwords * sizeof(h_bitset_word_t));
+        if (!words) return (h_atomic_bitset_t){0};
+        h_atomic_bitset_t bitset = {nbits, nwords, words};
+        for (size_t w=0;w<nwords;++w) words[w] = _impl_h_atomic_bitset_padding(&bitset, w);
+        return bitset;
+    }
+
+    bool h_atomic_bitset_test(h_atomic_bitset_t *bitset, size_t idx) {
+        H_ASSERT(idx < bitset->nbits, "Atomic bitset index %zu out of range (%zu bits).\n", idx, bitset->nbits);
+        if (idx >= bitset->nbits) return true;
+        h_bitset_word_t word = __atomic_load_n(&bitset->words[idx / _impl_H_BITSET_WORD_BITS], __ATOMIC_ACQUIRE);
+        return word & (1ULL << (idx % _impl_H_BITSET_WORD_BITS));
+    }
+    bool h_atomic_bitset_test_and_set(h_atomic_bitset_t *bitset, size_t idx) {
+        H_ASSERT(idx < bitset->nbits, "Atomic bitset index %zu out of range (%zu bits).\n", idx, bitset->nbits);
+        if (idx >= bitset->nbits) return true;
+        h_bitset_word_t mask = 1ULL << (idx % _impl_H_BITSET_WORD_BITS);
+        h_bitset_word_t old = __atomic_fetch_or(&bitset->words[idx / _impl_H_BITSET_WORD_BITS], mask, __ATOMIC_ACQ_REL);
+        return old & mask;
+    }
+    bool h_atomic_bitset_clear(h_atomic_bitset_t *bitset, size_t idx) {
+        H_ASSERT(idx < bitset->nbits, "Atomic bitset index %zu out of range (%zu bits).\n", idx, bitset->nbits);
+        if (idx >= bitset->nbits) return false;
+        h_bitset_word_t mask = 1ULL << (idx % _impl_H_BITSET_WORD_BITS);
+        h_bitset_word_t old = __atomic_fetch_and(&bitset->words[idx / _impl_H_BITSET_WORD_BITS], ~mask, __ATOMIC_ACQ_REL);
+        return old & mask;
+    }
+    void h_atomic_bitset_clear_all(h_atomic_bitset_t *bitset) {
+        // one store per word, padding included, so a concurrent claim never sees it cleared
+        for (size_t w=0;w<bitset->nwords;++w)
+            __atomic_store_n(&bitset->words[w], _impl_h_atomic_bitset_padding(bitset, w), __ATOMIC_RELEASE);
+    }
+
+    bool h_atomic_bitset_claim(h_atomic_bitset_t *bitset, size_t *hint, size_t *out_idx) {
+        if (!bitset->nwords) return false;
+
+        size_t start = (*hint / _impl_H_BITSET_WORD_BITS) % bitset->nwords;
+        for (size_t i=0;i<bitset->nwords;++i) {
+            size_t w = start + i;
+            if (w >= bitset->nwords) w -= bitset->nwords;
+
+            h_bitset_word_t word = __atomic_load_n(&bitset->words[w], __ATOMIC_RELAXED);
+            while (~word) {
+                h_bitset_word_t mask = 1ULL << __builtin_ctzll(~word);
+                word = __atomic_fetch_or(&bitset->words[w], mask, __ATOMIC_ACQ_REL);
+                if (!(word & mask)) {
+                    *out_idx = w * _impl_H_BITSET_WORD_BITS + __builtin_ctzll(mask);
+                    *hint = *out_idx + 1;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    size_t h_atomic_bitset_thread_hint(h_atomic_bitset_t const *bitset, size_t thread_idx, size_t nthreads) {
+        if (!nthreads) return 0;
+        size_t nlines = bitset->nwords / _impl_H_ATOMIC_BITSET_LINE_WORDS;
+        return (nlines * thread_idx / nthreads) * _impl_H_ATOMIC_BITSET_LINE_WORDS * _impl_H_BITSET_WORD_BITS;
+    }
+    void h_atomic_bitset_free(h_atomic_bitset_t *bitset) {
+        free(bitset->words);
+        bitset->words = NULL;
+        bitset->nwords = 0;
+        bitset->nbits = 0;
+    }
+
+#endif
+
+#ifdef H_SKETCH
+
+    // Blocked Bloom filter
+
+    static const u32 _impl_h_bloom_salts[H_BLOOM_BLOCK_WORDS] = {
+        0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+        0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u
+    };
+
+    // false positive rate at a mean of load keys per block : block loads are Poisson, and a block
+    // holding c keys passes a query when each word has the probed bit among its c set ones
+    static double _impl_h_bloom_fp_rate(double load) {
+        double word_bits = (double)(sizeof(h_bitset_word_t) * 8);
+        double spread = 12.0 * sqrt(load) + 32.0, rate = 0.0;
+        for (double c=fmax(0.0, floor(load - spread));c<=load + spread;++c) {
+            double pmf = exp(c * log(load) - load - lgamma(c + 1.0));
+            rate += pmf * pow(1.0 - pow(1.0 - 1.0 / word_bits, c), H_BLOOM_BLOCK_WORDS);
+        }
+        return rate;
+    }
+
+    h_bloom_t h_create_bloom(size_t expected_keys, double fp_rate) {
+        if (!expected_keys) expected_keys = 1;
+        if (fp_rate <= 0.0 || fp_rate >= 1.0) fp_rate = 0.01;
+
+        // one bit per word, so k is fixed at H_BLOOM_BLOCK_WORDS and only the size follows fp_rate.
+        // Bisect on the mean keys per block, the unblocked formula underestimates the size
+        double lo = 1e-3, hi = 4096.0;
+        for (int i=0;i<64;++i) {
+            double mid = sqrt(lo * hi);
+            if (_impl_h_bloom_fp_rate(mid) > fp_rate) hi = mid;
+            else lo = mid;
+        }
+        size_t nblocks = (size_t)ceil((double)expected_keys / lo);
+        if (!nblocks) nblocks = 1;
+
+        size_t nwords = nblocks * H_BLOOM_BLOCK_WORDS;
+        h_bitset_word_t *words = aligned_alloc(H_CACHE_LINE_SIZE, nwords * sizeof(h_bitset_word_t));
+        if (!words) return (h_bloom_t){0};
+        memset(words, 0, nwords * sizeof(h_bitset_word_t));
+
+        return (h_bloom_t){nblocks, (h_bitset_t){nwords, words}};
+    }
+
+    static inline h_bitset_word_t *_impl_h_bloom_block(h_bloom_t const *bloom, u64 hash) {
+        size_t block = (size_t)(((hash >> 32) * bloom->nblocks) >> 32);
+        return bloom->bits.words + block * H_BLOOM_BLOCK_WORDS;
+    }
+
+    void h_bloom_insert_hash(h_bloom_t *bloom, u64 hash) {
+        h_bitset_word_t *block = _impl_h_bloom_block(bloom, hash);
+        u32 bits = (u32)hash;
+        for (int w=0;w<H_BLOOM_BLOCK_WORDS;++w)
+            block[w] |= 1ULL << ((bits * _impl_h_bloom_salts[w]) >> 26);
+    }
+    bool h_bloom_query_hash(h_bloom_t const *bloom, u64 hash) {
+        h_bitset_word_t const *block = _impl_h_bloom_block(bloom, hash);
+        u32 bits = (u32)hash;
+#ifdef __AVX2__
+        __m256i salts = _mm256_loadu_si256((__m256i const*)_impl_h_bloom_salts);
+        __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)bits), salts), 26);
+        __m256i one = _mm256_set1_epi64x(1);
+        __m256i mask_lo = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(shifts)));
+        __m256i mask_hi = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(shifts, 1)));
+        __m256i block_lo = _mm256_load_si256((__m256i const*)block);
+        __m256i block_hi = _mm256_load_si256((__m256i const*)block + 1);
+        return _mm256_testc_si256(block_lo, mask_lo) & _mm256_testc_si256(block_hi, mask_hi);
+#else
+        h_bitset_word_t missing = 0;
+        for (int w=0;w<H_BLOOM_BLOCK_WORDS;++w)
+            missing |= ~block[w] & (1ULL << ((bits * _impl_h_bloom_salts[w]) >> 26));
+        return !missing;
+#endif
+    }
+    void h_bloom_insert(h_bloom_t *bloom, void *key, size_t size) {
+        h_bloom_insert_hash(bloom, h_hash_bytes64(key, size));
+    }
+    bool h_bloom_query(h_bloom_t const *bloom, void *key, size_t size) {
+        return h_bloom_query_hash(bloom, h_hash_bytes64(key, size));
+    }
+
+    void h_bloom_insert_batch(h_bloom_t *bloom, u64 const *hashes, size_t n) {
+        for (size_t i=0;i<n;++i) {
+            // the block of a later key is fetched while the current one is updated
+            if (i + 8 < n) __builtin_prefetch(_impl_h_bloom_block(bloom, hashes[i + 8]), 1);
+            h_bloom_insert_hash(bloom, hashes[i]);
+        }
+    }
+    size_t h_bloom_query_batch(h_bloom_t const *bloom, u64 const *hashes, size_t n, bool *out) {
+        size_t hits = 0;
+        for (size_t i=0;i<n;++i) {
+            if (i + 8 < n) __builtin_prefetch(_impl_h_bloom_block(bloom, hashes[i + 8]), 0);
+            out[i] = h_bloom_query_hash(bloom, hashes[i]);
+            hits += out[i];
+        }
+        return hits;
+    }
+
+    bool h_bloom_merge(h_bloom_t *bloom, h_bloom_t *other) {
+        if (bloom->nblocks != other->nblocks) return false;
+        h_bitset_or(&bloom->bits, &other->bits);
+        return true;
+    }
+    void h_bloom_clear(h_bloom_t *bloom) {
+        h_bitset_clear_all(&bloom->bits);
+    }
+    void h_bloom_free(h_bloom_t *bloom) {
+        h_bitset_free(&bloom->bits);
+        bloom->nblocks = 0;
+    }
+
+    // Count-min sketch
+
+    h_count_min_t h_create_count_min(double epsilon, double delta) {
+        if (epsilon <= 0.0 || epsilon >= 1.0) epsilon = 0.001;
+        if (delta <= 0.0 || delta >= 1.0) delta = 0.01;
+
+        size_t width = (size_t)ceil(exp(1.0) / epsilon);
+        size_t depth = (size_t)ceil(log(1.0 / delta));
+        if (!depth) depth = 1;
+
+        u32 *counters = calloc(width * depth, sizeof(u32));
+        if (!counters) return (h_count_min_t){0};
+        return (h_count_min_t){width, depth, counters};
+    }
+
+    // row r uses h1 + r*h2 (Kirsch-Mitzenmacher), mapped to [0, width) without a modulo
+    static inline size_t _impl_h_count_min_slot(h_count_min_t const *sketch, u32 h1, u32 h2, size_t row) {
+        u32 h = h1 + (u32)row * h2;
+        return row * sketch->width + (size_t)(((u64)h * sketch->width) >> 32);
+    }
+
+    void h_count_min_add_hash(h_count_min_t *sketch, u32 hash, u32 count) {
+        u32 h2 = h_pcg_hash(hash) | 1u;
+        for (size_t r=0;r<sketch->depth;++r) {
+            u32 *c = &sketch->counters[_impl_h_count_min_slot(sketch, hash, h2, r)];
+            *c = *c > UINT32_MAX - count ? UINT32_MAX : *c + count;
+        }
+    }
+    u32 h_count_min_estimate_hash(h_count_min_t const *sketch, u32 hash) {
+        u32 h2 = h_pcg_hash(hash) | 1u;
+        u32 min = UINT32_MAX;
+        for (size_t r=0;r<sketch->depth;++r) {
+            u32 c = sketch->counters[_impl_h_count_min_slot(sketch, hash, h2, r)];
+            if (c < min) min = c;
+        }
+        return min;
+    }
+    void h_count_min_add(h_count_min_t *sketch, void *key, size_t size, u32 count) {
+        h_count_min_add_hash(sketch, h_hash(h_pcg_hash, key, size), count);
+    }
+    u32 h_count_min_estimate(h_count_min_t const *sketch, void *key, size_t size) {
+        return h_count_min_estimate_hash(sketch, h_hash(h_pcg_hash, key, size));
+    }
+
+    void h_count_min_add_batch(h_count_min_t *sketch, u32 const *hashes, size_t n) {
+        for (size_t i=0;i<n;++i) h_count_min_add_hash(sketch, hashes[i], 1);
+    }
+    void h_count_min_estimate_batch(h_count_min_t const *sketch, u32 const *hashes, size_t n, u32 *out) {
+        for (size_t i=0;i<n;++i) out[i] = h_count_min_estimate_hash(sketch, hashes[i]);
+    }
+
+    bool h_count_min_merge(h_count_min_t *sketch, h_count_min_t const *other) {
+        if (sketch->width != other->width || sketch->depth != other->depth) return false;
+        for (size_t i=0;i<sketch->width*sketch->depth;++i) {
+            u32 a = sketch->counters[i], b = other->counters[i];
+            sketch->counters[i] = a > UINT32_MAX - b ? UINT32_MAX : a + b;
+        }
+        return true;
+    }
+    void h_count_min_clear(h_count_min_t *sketch) {
+        memset(sketch->counters, 0, sketch->width * sketch->depth * sizeof(u32));
+    }
+    void h_count_min_free(h_count_min_t *sketch) {
+        free(sketch->counters);
+        sketch->counters = NULL;
+        sketch->width = 0;
+        sketch->depth = 0;
+    }
+
+#endif
+
+#ifdef H_IO
+
+    h_file_reader_t h_file_reader_from_fd(int fd, char delim) {
+        h_file_reader_t reader = {fd, false, false, false, delim, NULL, 0, 0, 0};
+        if (fd < 0) return reader;
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED) {
+                madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+                reader.mapped = true;
+                reader.data = map;
+                reader.size = (size_t)st.st_size;
+                reader.cap = reader.size;
+                reader.eof = true;
+                return reader;
+            }
+        }
+
+        reader.data = malloc(H_FILE_READER_CHUNK_SIZE);
+        reader.cap = reader.data ? H_FILE_READER_CHUNK_SIZE : 0;
+        return reader;
+    }
+    h_file_reader_t h_file_reader_open(char const *path, char delim) {
+        int fd = open(path, O_RDONLY);
+        h_file_reader_t reader = h_file_reader_from_fd(fd, delim);
+        reader.owns_fd = fd >= 0;
+        return reader;
+    }
+    bool h_file_reader_ok(h_file_reader_t const *reader) {
+        return reader->fd >= 0 && reader->cap > 0;
+    }
+
+    // moves the unread bytes to the front and reads more after them, growing the buffer when full
+    static bool _impl_h_file_reader_fill(h_file_reader_t *reader) {
+        if (reader->eof) return false;
+
+        size_t pending = reader->size - reader->pos;
+        if (reader->pos) {
+            memmove(reader->data, reader->data + reader->pos, pending);
+            reader->pos = 0;
+            reader->size = pending;
+        }
+        if (reader->size == reader->cap) {
+            char *data = realloc(reader->data, reader->cap * 2);
+            if (!data) return false;
+            reader->data = data;
+            reader->cap *= 2;
+        }
+
+        for (;;) {
+            ssize_t n = read(reader->fd, reader->data + reader->size, reader->cap - reader->size);
+            if (n > 0) {
+                reader->size += (size_t)n;
+                return true;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            reader->eof = true;
+            return false;
+        }
+    }
+
+    bool h_file_reader_next(h_file_reader_t *reader, h_string_view_t *record) {
+        if (!reader->data) return false;
+
+        size_t scanned = reader->pos;
+        for (;;) {
+            char const *found = memchr(reader->data + scanned, reader->delim, reader->size - scanned);
+            if (found) {
+                *record = (h_string_view_t){reader->data + reader->pos, found - (reader->data + reader->pos)};
+                reader->pos = found - reader->data + 1;
+                return true;
+            }
+
+            // only look at the newly read bytes on the next pass
+            size_t offset = reader->size - reader->pos;
+            if (!_impl_h_file_reader_fill(reader)) break;
+            scanned = reader->pos + offset;
+        }
+
+        if (reader->pos >= reader->size) return false;
+        *record = (h_string_view_t){reader->data + reader->pos, reader->size - reader->pos};
+        reader->pos = reader->size;
+        return true;
+    }
+
+    void h_file_reader_close(h_file_reader_t *reader) {
+        if (reader->mapped) munmap(reader->data, reader->size);
+        else free(reader->data);
+        if (reader->owns_fd) close(reader->fd);
+        *reader = (h_file_reader_t){-1, false, false, true, reader->delim, NULL, 0, 0, 0};
+    }
+
+#define _impl_H_SNAPSHOT_MAGIC "HCLIBSNP"
+#define _impl_H_SNAPSHOT_BYTE_ORDER 0x01020304u
+#define _impl_H_SNAPSHOT_ALIGN(x) (((x) + H_CACHE_LINE_SIZE - 1) & ~(u64)(H_CACHE_LINE_SIZE - 1))
+
+    // four independent multiply-xorshift lanes so the checksum keeps up with the disk
+    static u64 _impl_h_snapshot_checksum(void const *data, size_t size) {
+        unsigned char const *p = (unsigned char const*)data;
+        u64 lanes[4] = {0x9e3779b97f4a7c15ull, 0xbf58476d1ce4e5b9ull, 0x94d049bb133111ebull, 0xd6e8feb86659fd93ull ^ size};
+        while (size >= 32) {
+            for (int i=0;i<4;++i) {
+                u64 w;
+                memcpy(&w, p + i * 8, 8);
+                lanes[i] = (lanes[i] ^ w) * 0xff51afd7ed558ccdull;
+                lanes[i] ^= lanes[i] >> 29;
+            }
+            p += 32;
+            size -= 32;
+        }
+        for (int i=0;size;++i) {
+            u64 w = 0;
+            size_t n = size < 8 ? size : 8;
+            memcpy(&w, p, n);
+            lanes[i] = (lanes[i] ^ w) * 0xff51afd7ed558ccdull;
+            lanes[i] ^= lanes[i] >> 29;
+            p += n;
+            size -= n;
+        }
+        u64 h = lanes[0];
+        for (int i=1;i<4;++i) {
+            h = (h ^ lanes[i]) * 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+        }
+        return h;
+    }
+    static u64 _impl_h_snapshot_payload_checksum(h_snapshot_header_t const *header, void const *const sections[3]) {
+        u64 h = 0;
+        for (int i=0;i<3;++i)
+            h = (h ^ _impl_h_snapshot_checksum(sections[i], header->section_sizes[i])) * 0xff51afd7ed558ccdull;
+        return h;
+    }
+
+    // lays the sections out, then writes to a temporary file renamed over path so readers never
+    // map a partial snapshot
+    static bool _impl_h_snapshot_write(h_snapshot_header_t *header, void const *const sections[3], char const *path) {
+        memcpy(header->magic, _impl_H_SNAPSHOT_MAGIC, 8);
+        header->version = H_SNAPSHOT_VERSION;
+        header->byte_order = _impl_H_SNAPSHOT_BYTE_ORDER;
+        header->word_size = sizeof(size_t);
+        u64 offset = _impl_H_SNAPSHOT_ALIGN(sizeof(h_snapshot_header_t));
+        for (int i=0;i<3;++i) {
+            header->sections[i] = offset;
+            offset = _impl_H_SNAPSHOT_ALIGN(offset + header->section_sizes[i]);
+        }
+        header->file_size = offset;
+        header->payload_checksum = _impl_h_snapshot_payload_checksum(header, sections);
+        header->header_checksum = _impl_h_snapshot_checksum(header, offsetof(h_snapshot_header_t, header_checksum));
+
+        size_t path_len = strlen(path);
+        char *tmp_path = malloc(path_len + 5);
+        if (!tmp_path) return false;
+        memcpy(tmp_path, path, path_len);
+        memcpy(tmp_path + path_len, ".tmp", 5);
+
+        FILE *file = fopen(tmp_path, "wb");
+        bool ok = file != NULL;
+        static char const padding[H_CACHE_LINE_SIZE];
+        u64 written = 0;
+        if (ok) {
+            ok = fwrite(header, sizeof(h_snapshot_header_t), 1, file) == 1;
+            written = sizeof(h_snapshot_header_t);
+        }
+        for (int i=0;ok && i<3;++i) {
+            ok = fwrite(padding, 1, header->sections[i] - written, file) == header->sections[i] - written;
+            written = header->sections[i];
+            if (ok && header->section_sizes[i])
+                ok = fwrite(sections[i], header->section_sizes[i], 1, file) == 1;
+            written += header->section_sizes[i];
+        }
+        if (ok) ok = fwrite(padding, 1, header->file_size - written, file) == header->file_size - written;
+        // the data must be on disk before the new name can point at it
+        if (ok) ok = fflush(file) == 0 && fsync(fileno(file)) == 0;
+        if (file && fclose(file) != 0) ok = false;
+        if (ok) ok = rename(tmp_path, path) == 0;
+        if (!ok && file) remove(tmp_path);
+
+        if (ok) {
+            char const *slash = strrchr(path, '/'), *dir = ".";
+            if (slash) {
+                size_t dir_len = slash == path ? 1 : (size_t)(slash - path);
+                memcpy(tmp_path, path, dir_len);
+                tmp_path[dir_len] = 0;
+                dir = tmp_path;
+            }
+            int dir_fd = open(dir, O_RDONLY);
+            if (dir_fd >= 0) {
+                ok = fsync(dir_fd) == 0;
+                close(dir_fd);
+            }
+        }
+        free(tmp_path);
+        return ok;
+    }
+
+    bool h_array_save(h_array_t const *arr, char const *path) {
+        h_snapshot_header_t header = {0};
+        header.kind = H_SNAPSHOT_ARRAY;
+        header.el_size = arr->el_size;
+        header.count = arr->size;
+        header.section_sizes[0] = (u64)arr->size * arr->el_size;
+        void const *const sections[3] = {arr->data, NULL, NULL};
+        return _impl_h_snapshot_write(&header, sections, path);
+    }
+    bool h_hashmap_save(h_hashmap_t const *hashmap, char const *path) {
+        h_snapshot_header_t header = {0};
+        header.kind = H_SNAPSHOT_HASHMAP;
+        header.el_size = hashmap->pair_size;
+        header.count = (u64)hashmap->size;
+        header.nbuckets = hashmap->nbuckets;
+        if (hashmap->size > 0) header.hash_probe = hashmap->hash_fn(hashmap->kvpool);
+        header.section_sizes[0] = (u64)hashmap->size * hashmap->pair_size;
+        header.section_sizes[1] = (u64)hashmap->size * sizeof(size_t);
+        header.section_sizes[2] = (u64)hashmap->nbuckets * sizeof(size_t);
+        void const *const sections[3] = {hashmap->kvpool, hashmap->kvnextpool, hashmap->buckets};
+        return _impl_h_snapshot_write(&header, sections, path);
+    }
+
+    // every pair index (1 based, 0 ends a chain) is the target of exactly one bucket or next link,
+    // so chains stay in range and none loops back on itself
+    static bool _impl_h_snapshot_indices_valid(u64 count, size_t const *next, u64 nbuckets, size_t const *buckets) {
+        u64 *seen = calloc(count / 64 + 1, sizeof(u64));
+        if (!seen) return false;
+        u64 targets = 0;
+        bool ok = true;
+        for (u64 i=0;ok && i<nbuckets+count;++i) {
+            size_t idx = i < nbuckets ? buckets[i] : next[i - nbuckets];
+            if (!idx) continue;
+            ok = idx <= count && !(seen[(idx - 1) / 64] & (1ULL << ((idx - 1) % 64)));
+            if (ok) seen[(idx - 1) / 64] |= 1ULL << ((idx - 1) % 64);
+            targets++;
+        }
+        free(seen);
+        return ok && targets == count;
+    }
+
+    static bool _impl_h_snapshot_valid(h_snapshot_header_t const *header, size_t size, bool verify) {
+        if (size < sizeof(h_snapshot_header_t)) return false;
+        if (memcmp(header->magic, _impl_H_SNAPSHOT_MAGIC, 8) != 0) return false;
+        if (header->header_checksum != _impl_h_snapshot_checksum(header, offsetof(h_snapshot_header_t, header_checksum))) return false;
+        if (header->version != H_SNAPSHOT_VERSION || header->byte_order != _impl_H_SNAPSHOT_BYTE_ORDER || header->word_size != sizeof(size_t)) return false;
+        if (header->file_size != size) return false;
+        if (header->kind != H_SNAPSHOT_ARRAY && header->kind != H_SNAPSHOT_HASHMAP) return false;
+
+        void const *sections[3];
+        for (int i=0;i<3;++i) {
+            if (header->sections[i] % H_CACHE_LINE_SIZE || header->sections[i] > size || header->section_sizes[i] > size - header->sections[i]) return false;
+            sections[i] = (char const*)header + header->sections[i];
+        }
+        if (header->el_size == 0 || header->section_sizes[0] != header->count * header->el_size) return false;
+        if (header->kind == H_SNAPSHOT_HASHMAP) {
+            if (header->nbuckets == 0) return false;
+            if (header->section_sizes[1] != header->count * sizeof(size_t) || header->section_sizes[2] != header->nbuckets * sizeof(size_t)) return false;
+            if (!_impl_h_snapshot_indices_valid(header->count, sections[1], header->nbuckets, sections[2])) return false;
+        }
+
+        return !verify || header->payload_checksum == _impl_h_snapshot_payload_checksum(header, sections);
+    }
+
+    h_snapshot_t h_snapshot_open(char const *path, bool verify) {
+        h_snapshot_t snapshot = {NULL, 0};
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) return snapshot;
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (map != MAP_FAILED) {
+                if (_impl_h_snapshot_valid(map, (size_t)st.st_size, verify)) {
+                    // hashmap lookups jump around the pools, readahead would only waste IO
+                    if (((h_snapshot_header_t const*)map)->kind == H_SNAPSHOT_HASHMAP)
+                        madvise(map, (size_t)st.st_size, MADV_RANDOM);
+                    snapshot.header = map;
+                    snapshot.size = (size_t)st.st_size;
+                }
+                else munmap(map, (size_t)st.st_size);
+            }
+        }
+        close(fd);
+        return snapshot;
+    }
+    bool h_snapshot_ok(h_snapshot_t const *snapshot) {
+        return snapshot->header != NULL;
+    }
+    h_snapshot_kind_t h_snapshot_kind(h_snapshot_t const *snapshot) {
+        return snapshot->header ? (h_snapshot_kind_t)snapshot->header->kind : H_SNAPSHOT_NONE;
+    }
+
+    h_array_t h_snapshot_array(h_snapshot_t const *snapshot) {
+        if (h_snapshot_kind(snapshot) != H_SNAPSHOT_ARRAY) return (h_array_t){0};
+        h_snapshot_header_t const *header = snapshot->header;
+        return (h_array_t){header->count, header->count, header->el_size, (char*)header + header->sections[0]};
+    }
+    h_hashmap_t h_snapshot_hashmap(h_snapshot_t const *snapshot, h_kvpair_hash_fn_t *hash_fn, h_kcompare_fn_t *kcompare_fn) {
+        h_hashmap_t hashmap = {0};
+        if (h_snapshot_kind(snapshot) != H_SNAPSHOT_HASHMAP) return hashmap;
+        h_snapshot_header_t const *header = snapshot->header;
+        void *kvpool = (char*)header + header->sections[0];
+        if (header->count > 0 && hash_fn(kvpool) != header->hash_probe) return hashmap;
+
+        hashmap.nbuckets = header->nbuckets;
+        hashmap.pool_capacity = (ssize_t)header->count;
+        hashmap.size = (ssize_t)header->count;
+        hashmap.pair_size = header->el_size;
+        hashmap.kvpool = kvpool;
+        hashmap.kvnextpool = (size_t*)((char*)header + header->sections[1]);
+        hashmap.buckets = (size_t*)((char*)header + header->sections[2]);
+        hashmap.hash_fn = hash_fn;
+        hashmap.kcompare_fn = kcompare_fn;
+        return hashmap;
+    }
+
+    void h_snapshot_close(h_snapshot_t *snapshot) {
+        if (snapshot->header) munmap((void*)snapshot->header, snapshot->size);
+        *snapshot = (h_snapshot_t){NULL, 0};
+    }
+
 #endif
 
 #ifdef H_SMARTPTR
@@ -1005,6 +4386,156 @@ __attribute__((always_inline)) inline void h_smart_free(void *ptr);
 #endif
 #endif
 
+#ifdef H_TRACE
+    static h_trace_buffer_t *_impl_h_trace_buffers;
+    static u32 _impl_h_trace_next_tid;
+    static __thread h_trace_buffer_t *_impl_h_trace_local;
+    static pthread_key_t _impl_h_trace_key;
+    static pthread_mutex_t _impl_h_trace_flush_lock = PTHREAD_MUTEX_INITIALIZER;
+    static u64 _impl_h_trace_epoch_ticks;
+    static u64 _impl_h_trace_epoch_ns;
+
+    u64 _impl_h_trace_clock_ns(void) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+    }
+
+    // runs at thread exit, the ring is left to the flush and to the next thread attaching
+    static void _impl_h_trace_detach(void *buffer) {
+        _impl_h_trace_local = NULL;
+        __atomic_store_n(&((h_trace_buffer_t*)buffer)->retired, 1, __ATOMIC_RELEASE);
+    }
+
+    // tick and clock readings at startup, the flush converts ticks with a second pair
+    __attribute__((constructor))
+    void _impl_h_trace_init() {
+        pthread_key_create(&_impl_h_trace_key, _impl_h_trace_detach);
+        _impl_h_trace_epoch_ns = _impl_h_trace_clock_ns();
+        _impl_h_trace_epoch_ticks = H_TRACE_NOW();
+    }
+
+    static h_trace_buffer_t *_impl_h_trace_attach(void) {
+        // claim a ring retired by an exited thread, its head carries on where that thread stopped
+        for (h_trace_buffer_t *buffer = __atomic_load_n(&_impl_h_trace_buffers, __ATOMIC_ACQUIRE); buffer; buffer = buffer->next) {
+            u32 retired = 1;
+            if (__atomic_load_n(&buffer->retired, __ATOMIC_RELAXED) &&
+                __atomic_compare_exchange_n(&buffer->retired, &retired, 0, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                pthread_setspecific(_impl_h_trace_key, buffer);
+                return _impl_h_trace_local = buffer;
+            }
+        }
+
+        h_trace_buffer_t *buffer = calloc(1, sizeof(h_trace_buffer_t));
+        h_trace_event_t *events = malloc(H_TRACE_BUFFER_EVENTS * sizeof(h_trace_event_t));
+        if (!buffer || !events) {
+            free(buffer);
+            free(events);
+            return NULL;
+        }
+        buffer->events = events;
+        buffer->tid = __atomic_fetch_add(&_impl_h_trace_next_tid, 1, __ATOMIC_RELAXED) + 1;
+
+        // buffers are never unlinked, so a push is the only concurrent change to the list
+        h_trace_buffer_t *head = __atomic_load_n(&_impl_h_trace_buffers, __ATOMIC_RELAXED);
+        do buffer->next = head;
+        while (!__atomic_compare_exchange_n(&_impl_h_trace_buffers, &head, buffer, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+        pthread_setspecific(_impl_h_trace_key, buffer);
+        return _impl_h_trace_local = buffer;
+    }
+
+    static inline void _impl_h_trace_push(char const *name, u64 start, u64 value, h_trace_kind_t kind) {
+        h_trace_buffer_t *buffer = _impl_h_trace_local;
+        if (!buffer && !(buffer = _impl_h_trace_attach())) return;
+        u64 head = buffer->head;
+        buffer->events[head & (H_TRACE_BUFFER_EVENTS - 1)] = (h_trace_event_t){name, start, value, kind, 0};
+        __atomic_store_n(&buffer->head, head + 1, __ATOMIC_RELEASE);
+    }
+
+    void h_trace_zone_end(h_trace_zone_t *zone) {
+        u64 end = H_TRACE_NOW();
+        _impl_h_trace_push(zone->name, zone->start, end - zone->start, H_TRACE_KIND_ZONE);
+    }
+    void h_trace_counter(char const *name, i64 value) {
+        _impl_h_trace_push(name, H_TRACE_NOW(), (u64)value, H_TRACE_KIND_COUNTER);
+    }
+
+    static void _impl_h_trace_json_string(FILE *out, char const *str) {
+        fputc('"', out);
+        for (;*str;++str) {
+            unsigned char c = (unsigned char)*str;
+            if (c == '"' || c == '\\') fprintf(out, "\\%c", c);
+            else if (c < 0x20) fprintf(out, "\\u%04x", c);
+            else fputc(c, out);
+        }
+        fputc('"', out);
+    }
+
+    size_t h_trace_write(FILE *out) {
+        pthread_mutex_lock(&_impl_h_trace_flush_lock);
+
+        // ticks per microsecond, over at least 10 ms so the rdtsc rate is meaningful
+        u64 now_ns = _impl_h_trace_clock_ns();
+        while (now_ns - _impl_h_trace_epoch_ns < 10000000ull) now_ns = _impl_h_trace_clock_ns();
+        u64 now_ticks = H_TRACE_NOW();
+        double ticks_per_us = (double)(now_ticks - _impl_h_trace_epoch_ticks) * 1e3 / (double)(now_ns - _impl_h_trace_epoch_ns);
+        if (!(ticks_per_us > 0)) ticks_per_us = 1e-3;
+
+        h_trace_event_t *copy = malloc(H_TRACE_BUFFER_EVENTS * sizeof(h_trace_event_t));
+        size_t written = 0;
+        u64 dropped = 0;
+        bool first = true;
+        fprintf(out, "{\"traceEvents\":[\n");
+        for (h_trace_buffer_t *buffer = __atomic_load_n(&_impl_h_trace_buffers, __ATOMIC_ACQUIRE); copy && buffer; buffer = buffer->next) {
+            fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"thread %u\"}}",
+                first ? "" : ",\n", buffer->tid, buffer->tid);
+            first = false;
+
+            u64 head = __atomic_load_n(&buffer->head, __ATOMIC_ACQUIRE);
+            u64 from = buffer->tail;
+            if (head - from > H_TRACE_BUFFER_EVENTS) {
+                dropped += head - from - H_TRACE_BUFFER_EVENTS;
+                from = head - H_TRACE_BUFFER_EVENTS;
+            }
+            for (u64 i=from;i<head;++i) copy[i - from] = buffer->events[i & (H_TRACE_BUFFER_EVENTS - 1)];
+            buffer->tail = head;
+
+            // the owner kept writing while we copied, anything it may have lapped is torn
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            u64 lapped = __atomic_load_n(&buffer->head, __ATOMIC_RELAXED) - H_TRACE_BUFFER_EVENTS;
+            for (u64 i=from;i<head;++i) {
+                if ((i64)(i - lapped) <= 0) {
+                    dropped++;
+                    continue;
+                }
+                h_trace_event_t const *event = &copy[i - from];
+                double ts = (double)(i64)(event->start - _impl_h_trace_epoch_ticks) / ticks_per_us;
+                fprintf(out, ",\n{\"name\":");
+                _impl_h_trace_json_string(out, event->name);
+                if (event->kind == H_TRACE_KIND_ZONE)
+                    fprintf(out, ",\"cat\":\"hclib\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                        buffer->tid, ts < 0 ? 0 : ts, (double)event->value / ticks_per_us);
+                else
+                    fprintf(out, ",\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"value\":%lld}}",
+                        buffer->tid, ts < 0 ? 0 : ts, (long long)(i64)event->value);
+                written++;
+            }
+        }
+        fprintf(out, "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":%llu}}\n", (unsigned long long)dropped);
+        free(copy);
+
+        pthread_mutex_unlock(&_impl_h_trace_flush_lock);
+        return written;
+    }
+    bool h_trace_save(char const *path) {
+        FILE *out = fopen(path, "w");
+        if (!out) return false;
+        h_trace_write(out);
+        return fclose(out) == 0;
+    }
+#endif
+
 #ifdef H_DEBUG
     __attribute__((destructor))
     void h_debug_end_warnings() {
@@ -0,0 +1,192 @@
+/*
+ *  Perfect hash table generator : reads a fixed key list and writes a header holding a
+ *  collision free table and its lookup, one displacement read, one probe and one compare.
+ *  The output is plain C that also compiles as C++, it only needs hclib.h with H_HASH declared,
+ *  and for string keys h_phash_hash_bytes defined in some translation unit (H_DEFINITIONS).
+ *  Integer tables carry compile time checks : the compiler recomputes every key's bucket and slot
+ *  with the H_PHASH_ macros and rejects the header if it disagrees with the generator.
+ *
+ *  One key per line, optionally followed by a tab and a C expression for its value (the line
+ *  index otherwise). Empty lines and lines starting with '#' are skipped.
+ *
+ *  build : gcc -O2 -o phash_gen tools/phash_gen.c -lm
+ *  usage : phash_gen [-u] [-t value_type] name [keys_file] > name_phash.h
+ *          -u  keys are unsigned 32 bit integers (decimal, 0x hex or 0 octal) instead of strings
+ */
+
+#include <stdbool.h>
+#include <sys/types.h>
+#include <ctype.h>
+
+#define H_ALL
+#define H_DEFINITIONS
+#include "../hclib.h"
+
+typedef struct key_line_t {
+    h_string_view_t key;
+    h_string_view_t value;
+    u32 number;
+} key_line_t;
+
+static void print_string(h_string_view_t str) {
+    putchar('"');
+    for (size_t i=0;i<str.size;++i) {
+        unsigned char c = (unsigned char)str.data[i];
+        if (c == '"' || c == '\\') printf("\\%c", c);
+        else if (isprint(c)) putchar(c);
+        else printf("\\%03o", c);
+    }
+    putchar('"');
+}
+
+static void print_value(key_line_t const *key, u32 index) {
+    if (key->value.size) printf("%.*s", (int)key->value.size, key->value.data);
+    else printf("%u", index);
+}
+
+int main(int argc, char **argv) {
+    bool integers = false;
+    char const *value_type = "int";
+    char const *name = NULL, *path = NULL;
+    for (int i=1;i<argc;++i) {
+        if (!strcmp(argv[i], "-u")) integers = true;
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc) value_type = argv[++i];
+        else if (!name) name = argv[i];
+        else if (!path) path = argv[i];
+    }
+    if (!name) {
+        fprintf(stderr, "usage : phash_gen [-u] [-t value_type] name [keys_file]\n");
+        return 1;
+    }
+
+    h_file_reader_t reader = path ? h_file_reader_open(path, '\n') : h_file_reader_from_fd(0, '\n');
+    if (!h_file_reader_ok(&reader)) {
+        fprintf(stderr, "phash_gen : can't read %s\n", path ? path : "stdin");
+        return 1;
+    }
+
+    // records are only stable in a mapped file, so keep copies
+    h_array_t keys = H_CREATE_ARRAY(key_line_t, 64);
+    h_string_view_t line;
+    while (h_file_reader_next(&reader, &line)) {
+        if (line.size && line.data[line.size - 1] == '\r') line.size--;
+        if (!line.size || line.data[0] == '#') continue;
+
+        key_line_t key = {line, {NULL, 0}, 0};
+        char const *tab = memchr(line.data, '\t', line.size);
+        if (tab) {
+            key.key = h_string_view_sub(line, 0, tab - line.data);
+            key.value = h_string_view_sub(line, tab - line.data + 1, line.size - (tab - line.data) - 1);
+        }
+        key.key = h_string_view(h_string_view_dup(key.key));
+        if (key.value.size) key.value = h_string_view(h_string_view_dup(key.value));
+        if (integers) {
+            char *end;
+            errno = 0;
+            unsigned long number = strtoul(key.key.data, &end, 0);
+            if (errno || *end || end == key.key.data || number > UINT32_MAX) {
+                fprintf(stderr, "phash_gen : '%s' is not a 32 bit unsigned integer\n", key.key.data);
+                return 1;
+            }
+            key.number = (u32)number;
+        }
+        H_ARRAY_PUSH(key_line_t, keys, key);
+    }
+    h_file_reader_close(&reader);
+
+    u32 n = (u32)keys.size;
+    key_line_t *list = keys.data;
+    h_phash_t phash;
+    if (integers) {
+        u32 *numbers = malloc((n + 1) * sizeof(u32));
+        for (u32 i=0;i<n;++i) numbers[i] = list[i].number;
+        phash = h_create_phash_u32(numbers, n);
+        free(numbers);
+    }
+    else {
+        void const **data = malloc((n + 1) * sizeof(void*));
+        size_t *sizes = malloc((n + 1) * sizeof(size_t));
+        for (u32 i=0;i<n;++i) {
+            data[i] = list[i].key.data;
+            sizes[i] = list[i].key.size;
+        }
+        phash = h_create_phash_bytes(data, sizes, n);
+        free(data);
+        free(sizes);
+    }
+    if (!phash.slots) {
+        fprintf(stderr, "phash_gen : no perfect hash found, check the key list for duplicates\n");
+        return 1;
+    }
+
+    char upper[256];
+    size_t len = strlen(name) < sizeof(upper) - 1 ? strlen(name) : sizeof(upper) - 1;
+    for (size_t i=0;i<len;++i) upper[i] = (char)toupper((unsigned char)name[i]);
+    upper[len] = 0;
+    u32 nbuckets = 1u << phash.bucket_bits, nslots = 1u << phash.slot_bits;
+
+    printf("/*\n *  Generated by phash_gen from %u %s keys, do not edit.\n", n, integers ? "integer" : "string");
+    printf(" *  Needs hclib.h with H_HASH declared%s.\n */\n\n", integers ? "" : ", and h_phash_hash_bytes defined (H_DEFINITIONS)");
+    printf("#ifndef %s_PHASH_H\n#define %s_PHASH_H\n\n", upper, upper);
+    printf("#include <stdint.h>\n#include <string.h>\n\n");
+    printf("#define %s_SEED 0x%08xu\n", upper, phash.seed);
+    printf("#define %s_BUCKET_BITS %u\n", upper, phash.bucket_bits);
+    printf("#define %s_SLOT_BITS %u\n", upper, phash.slot_bits);
+    printf("#define %s_COUNT %u\n\n", upper, n);
+
+    printf("typedef struct %s_entry_t {\n", name);
+    if (integers) printf("    uint32_t key;\n    uint32_t used;\n");
+    else printf("    char const *key;\n    uint32_t size;\n");
+    printf("    %s value;\n} %s_entry_t;\n\n", value_type, name);
+
+    printf("static const uint16_t %s_disp[%u] = {", name, nbuckets);
+    for (u32 b=0;b<nbuckets;++b) printf("%s%u,", b % 16 ? " " : "\n    ", phash.disp[b]);
+    printf("\n};\n\n");
+
+    printf("static const %s_entry_t %s_table[%u] = {\n", name, name, nslots);
+    for (u32 s=0;s<nslots;++s) {
+        u32 k = phash.slots[s];
+        if (k == H_PHASH_EMPTY) {
+            printf("    {0, 0, 0},\n");
+            continue;
+        }
+        if (integers) printf("    {0x%08xu, 1, ", list[k].number);
+        else {
+            printf("    {");
+            print_string(list[k].key);
+            printf(", %zu, ", list[k].key.size);
+        }
+        print_value(&list[k], k);
+        printf("},\n");
+    }
+    printf("};\n\n");
+
+    if (integers) {
+        printf("// the compiler places every key again through the hclib macros\n");
+        for (u32 s=0;s<nslots;++s) {
+            u32 k = phash.slots[s];
+            if (k == H_PHASH_EMPTY) continue;
+            u32 hash = H_PHASH_HASH(list[k].number, phash.seed);
+            u32 b = H_PHASH_BUCKET(hash, phash.bucket_bits);
+            printf("typedef char %s_phash_check_%u[H_PHASH_BUCKET(H_PHASH_HASH(0x%08xu, %s_SEED), %s_BUCKET_BITS) == %u"
+                " && H_PHASH_SLOT(H_PHASH_HASH(0x%08xu, %s_SEED), %u, %s_SLOT_BITS) == %u ? 1 : -1];\n",
+                name, s, list[k].number, upper, upper, b, list[k].number, upper, phash.disp[b], upper, s);
+        }
+        printf("\nstatic inline %s_entry_t const *%s_find(uint32_t key) {\n", name, name);
+        printf("    uint32_t hash = H_PHASH_HASH(key, %s_SEED);\n", upper);
+        printf("    %s_entry_t const *entry = &%s_table[H_PHASH_SLOT(hash, %s_disp[H_PHASH_BUCKET(hash, %s_BUCKET_BITS)], %s_SLOT_BITS)];\n",
+            name, name, name, upper, upper);
+        printf("    return entry->used && entry->key == key ? entry : (%s_entry_t const*)0;\n}\n\n", name);
+    }
+    else {
+        printf("static inline %s_entry_t const *%s_find(char const *key, size_t size) {\n", name, name);
+        printf("    uint64_t hash = h_phash_hash_bytes(key, size, %s_SEED);\n", upper);
+        printf("    %s_entry_t const *entry = &%s_table[H_PHASH_SLOT(hash, %s_disp[H_PHASH_BUCKET(hash, %s_BUCKET_BITS)], %s_SLOT_BITS)];\n",
+            name, name, name, upper, upper);
+        printf("    return entry->key && entry->size == size && memcmp(entry->key, key, size) == 0 ? entry : (%s_entry_t const*)0;\n}\n\n", name);
+    }
+    printf("#endif\n");
+
+    h_phash_free(&phash);
+    return 0;
+}